@@ -1,5 +1,99 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
+//drapeau d'un état d'un automate compact indiquant que l'état est final
+#define ETAT_ACCEPTEUR 1
+
+//drapeau d'un état depuis lequel aucun état final n'est accessible : plus aucun mot passant par lui n'est reconnu
+#define ETAT_MORT 2
+
+//drapeau d'un état depuis lequel tous les mots sont reconnus, quelle que soit la suite lue
+#define ETAT_UNIVERSEL 4
+
+//nombre maximal d'octets faisant quitter un état pour que est_reconnu_compact le traverse par recherche vectorielle
+#define ACCELERATION_OCTETS_MAX 4
+
+//valeur de acceleration pour un état mort ou universel : la suite du mot ne change plus le résultat, la lecture s'y arrête
+#define ACCELERATION_ARRET 255
+
+//nombre maximal d'états d'un automate non déterministe simulé par vecteurs de bits
+#define AFND_BITS_MAX 512
+
+//nombre de mots d'un bloc de travail de reconnaitreLotParallele, multiple de 8 pour que deux blocs n'écrivent jamais le même octet de résultats
+#define TAILLE_BLOC_LOT 256
+
+//taille minimale d'un tronçon de est_reconnu_parallele, en dessous le texte est lu d'un seul tenant
+#define TAILLE_TRONCON_MIN 65536
+
+//taille du tampon de lecture de reconnaitreDescripteur
+#define TAILLE_TAMPON_FLUX 65536
+
+//types des noeuds de l'arbre d'une expression rationnelle
+#define NOEUD_ENSEMBLE 0
+#define NOEUD_VIDE 1
+#define NOEUD_UNION 2
+#define NOEUD_CONCATENATION 3
+#define NOEUD_ETOILE 4
+#define NOEUD_PLUS 5
+#define NOEUD_OPTION 6
+
+//borne maximale d'une répétition {m,n} dans une expression rationnelle
+#define REPETITION_MAX 1000
+
+//taille par défaut d'un bloc d'arène
+#define TAILLE_BLOC_ARENE 65536
+
+//taille par défaut en octets d'un cache de compilation, et celle du cache partagé par tout le processus
+#define TAILLE_CACHE_COMPILATION (64*1024*1024)
+
+//structure représentant un bloc de mémoire d'une arène, suivi de ses données
+typedef struct BlocArene
+{
+	//bloc alloué avant celui-ci
+	struct BlocArene* precedent;
+
+	//taille des données du bloc et nombre d'octets déjà distribués
+	size_t taille;
+	size_t utilise;
+} BlocArene;
+
+//structure représentant une arène : la mémoire est distribuée par blocs et n'est rendue qu'en une fois par viderArene ou detruireArene
+typedef struct Arene
+{
+	//bloc en cours de distribution, les blocs précédents sont chaînés depuis lui
+	BlocArene* bloc;
+
+	//taille minimale d'un nouveau bloc
+	size_t tailleBloc;
+
+	//dernière allocation, la seule qui puisse être agrandie sur place ou rendue
+	void* derniere;
+} Arene;
+
+//structure représentant une transition d'un automate fini non déterministe
+//la transition est déclenchée par tous les caractères compris entre debut et fin inclus
+typedef struct Arc
+{
+	//état d'arrivée de la transition
+	int arrivee;
+
+	//premier caractère déclenchant la transition
+	unsigned char debut;
+
+	//dernier caractère déclenchant la transition
+	unsigned char fin;
+} Arc;
 
 //structure représentant un automate fini non déterministe
 typedef struct AFND
@@ -7,24 +101,45 @@ typedef struct AFND
 	//nombre d'états de notre automate
 	int nbEtats;
 
-	//nombre de transitions entre chaque couple départ+arrivée
-	int** nbTransitions;
+	//nombre de cases allouées dans les tableaux indexés par état, les combinateurs en place la doublent quand elle est atteinte
+	int capaciteEtats;
 
-	//pour chaque couple départ+arrivée contient un tableau des transitions entre départ et arrivée
-	//chaque case contient le caractère déclenchant la transition
-	int*** transition;
+	//nombre de transitions partant de chaque état
+	int* nbTransitions;
+
+	//nombre de cases allouées dans le tableau de transitions de chaque état
+	int* capaciteTransitions;
+
+	//pour chaque état de départ contient le tableau des transitions qui en partent
+	Arc** transition;
+
+	//nombre de transitions spontanées partant de chaque état et nombre de cases allouées pour elles
+	int* nbEpsilons;
+	int* capaciteEpsilons;
+
+	//pour chaque état de départ contient le tableau des états d'arrivée de ses transitions spontanées, franchies sans lire de caractère
+	int** epsilon;
+
+	//numéro du motif reconnu par chaque état final, -1 pour un état sans motif, NULL si aucun motif n'a été attribué
+	//seuls les états finaux sont lus, les unions et les copies conservent les motifs
+	int* motif;
 
 	//nombre d'états initiaux de notre automate
 	int nbEtatsInitiaux;
 
-	//tableau contenant les états initiaux de notre automate
+	//tableau contenant les états initiaux de notre automate et son nombre de cases allouées
 	int* initial;
+	int capaciteInitiaux;
 
 	//nombre d'états finaux ou accepteurs de notre automate
 	int nbEtatsFinaux;
 
-	//tableau contenant les états finaux ou accepteurs de notre automate
+	//tableau contenant les états finaux ou accepteurs de notre automate et son nombre de cases allouées
 	int* final;
+	int capaciteFinaux;
+
+	//arène dont viennent tous les tableaux de l'automate, NULL s'ils viennent de malloc
+	Arene* arene;
 } AFND;
 
 //structure représentant un automate fini déterministe
@@ -33,8 +148,16 @@ typedef struct AFD
 	//nombre d'états de notre automate
 	int nbEtats;
 
-	//pour chaque couple caractère+départ contient l'état d'arrivée de la transition pour le caractère donné pour l'état de départ donné
-	//contient -1 si il n'existe pas de transition par le caractère donné pour l'état de départ donné
+	//nombre de classes de caractères de notre automate
+	//deux caractères sont dans la même classe si ils mènent aux mêmes états depuis tous les états
+	int nbClasses;
+
+	//classe de chaque caractère, les transitions sont indexées par classe et non par caractère
+	unsigned char classe[256];
+
+	//pour chaque couple classe+départ contient l'état d'arrivée de la transition pour la classe donnée pour l'état de départ donné
+	//contient -1 si il n'existe pas de transition par la classe donnée pour l'état de départ donné, le mot est alors rejeté
+	//seules les nbClasses premières cases sont allouées
 	int* transition[256];
 
 	//état initial de notre automate
@@ -45,14 +168,484 @@ typedef struct AFD
 
 	//tableau contenant les états finaux ou accepteurs de notre automate
 	int* final;	
+
+	//arène dont viennent tous les tableaux de l'automate, NULL s'ils viennent de malloc
+	Arene* arene;
 } AFD;
 
+//structure représentant un automate fini déterministe qui reconnaît plusieurs motifs à la fois
+//les états finaux de l'automate sont ceux dont l'ensemble de motifs n'est pas vide
+typedef struct AFDMotifs
+{
+	AFD automate;
+
+	//les motifs reconnus dans l'état e, triés, sont motifs[debutMotifs[e]] à motifs[debutMotifs[e+1]-1]
+	int* debutMotifs;
+	int* motifs;
+} AFDMotifs;
+
+//structure représentant un automate fini déterministe compilé pour la reconnaissance
+//les transitions sont rangées dans un seul tableau contigu état par état pour que chaque pas de lecture reste dans la même zone mémoire
+typedef struct AFDCompact
+{
+	//nombre d'états de notre automate
+	int nbEtats;
+
+	//taille en octets d'un numéro d'état dans la table de transitions : 1, 2 ou 4 selon le nombre d'états
+	int largeur;
+
+	//nombre de classes de caractères, repris de l'automate d'origine
+	int nbClasses;
+
+	//classe de chaque caractère
+	unsigned char classe[256];
+
+	//table de transitions, la destination de l'état e par le caractère c se trouve à l'indice e*nbClasses+classe[c]
+	//les numéros d'états sont des uint8_t, uint16_t ou uint32_t selon la largeur
+	void* transition;
+
+	//un octet de drapeaux par état, contient ETAT_ACCEPTEUR si l'état est final, ETAT_MORT ou ETAT_UNIVERSEL si la suite du mot
+	//ne peut plus changer le résultat
+	unsigned char* drapeaux;
+
+	//état initial de notre automate
+	int initial;
+
+	//pour chaque état, nombre d'octets qui le font quitter quand il y en a au plus ACCELERATION_OCTETS_MAX,
+	//ACCELERATION_ARRET pour un état mort ou universel et 0 sinon ; recalculé au chargement, jamais enregistré
+	unsigned char* acceleration;
+
+	//octets qui font quitter chaque état accéléré, ACCELERATION_OCTETS_MAX cases par état
+	unsigned char* octetsSortants;
+
+	//nombre d'états accélérés ou d'arrêt, la lecture octet par octet sans test d'accélération est gardée quand il vaut 0
+	int nbEtatsAcceleres;
+
+	//fichier projeté en mémoire dont viennent la table et les drapeaux, NULL s'ils viennent de malloc
+	void* projection;
+	size_t tailleProjection;
+} AFDCompact;
+
+//opérations ensemblistes réalisées par l'automate produit
+#define PRODUIT_INTERSECTION 0
+#define PRODUIT_DIFFERENCE 1
+#define PRODUIT_DIFFERENCE_SYMETRIQUE 2
+#define PRODUIT_UNION 3
+
+//formes du code C produit par genererCodeC : un bloc d'instructions par état reliés par goto, ou une table de transitions constante
+#define GENERATION_GOTO 0
+#define GENERATION_TABLE 1
+
+//version courante du format de fichier des automates compacts
+//la version 2 a un état mort explicite là où la version 1 restait sur place faute de transition
+#define VERSION_FICHIER_AFD 2
+
+//entête d'un fichier d'automate compact, suivie des 256 classes de caractères, de la table de transitions alignée sur 8 octets
+//puis des drapeaux des états ; les entiers sont écrits dans l'ordre d'octets de la machine, vérifié au chargement par le champ boutisme
+typedef struct EnteteAFDCompact
+{
+	//"AUTOMATO" sans zéro final
+	char magie[8];
+
+	//VERSION_FICHIER_AFD à l'écriture
+	uint32_t version;
+
+	//0x01020304 écrit dans l'ordre d'octets de la machine
+	uint32_t boutisme;
+
+	uint32_t nbEtats;
+	uint32_t largeur;
+	uint32_t nbClasses;
+	uint32_t initial;
+
+	//positions dans le fichier des classes, de la table de transitions et des drapeaux, puis taille totale du fichier
+	uint64_t decalageClasses;
+	uint64_t decalageTransition;
+	uint64_t decalageDrapeaux;
+	uint64_t tailleTotale;
+} EnteteAFDCompact;
+
+//structure représentant un ensemble d'ensembles d'états d'un automate non déterministe
+//utilisée par la construction par sous-ensembles pour retrouver en temps constant un état déterministe déjà découvert
+typedef struct TableEnsembles
+{
+	//nombre d'ensembles rangés dans la table
+	int nbEnsembles;
+
+	//nombre d'ensembles pouvant être rangés avant de réallouer debut et empreinte
+	int capaciteEnsembles;
+
+	//l'ensemble i occupe les cases debut[i] à debut[i+1]-1 du tableau elements
+	int* debut;
+
+	//empreinte de chaque ensemble, recalculée une seule fois à l'ajout
+	unsigned long* empreinte;
+
+	//composants triés de tous les ensembles mis bout à bout
+	int* elements;
+
+	//nombre de cases allouées pour elements
+	int capaciteElements;
+
+	//table de hachage à adressage ouvert contenant les numéros d'ensembles, -1 pour une case vide
+	int* index;
+
+	//nombre de cases de la table de hachage, toujours une puissance de 2
+	int capaciteIndex;
+
+	//arène dont viennent tous les tableaux de la table, NULL s'ils viennent de malloc
+	//la table peut ainsi être agrandie et libérée quelle que soit l'arène courante à ce moment
+	Arene* arene;
+} TableEnsembles;
+
+//structure représentant un automate déterministe construit paresseusement à partir d'un automate non déterministe
+//les états déterministes ne sont créés que lorsque la lecture d'un mot les atteint et sont gardés dans un cache de taille bornée
+//le cache est modifié pendant la reconnaissance, une structure ne doit donc pas être partagée entre plusieurs threads
+typedef struct AFDParesseux
+{
+	//automate non déterministe reconnu, il n'est pas copié et doit rester valide
+	AFND* automate;
+
+	//classes de caractères de l'automate non déterministe et premier caractère de chaque classe
+	int nbClasses;
+	unsigned char classe[256];
+	int representant[256];
+
+	//estFinal[i] vaut 1 si l'état i de l'automate non déterministe est final
+	unsigned char* estFinal;
+
+	//ensembles d'états non déterministes déjà rencontrés, l'état déterministe i est l'ensemble i
+	TableEnsembles table;
+
+	//transitions des états du cache rangées état par état, -2 si la transition n'a pas encore été calculée et -1 vers l'ensemble vide
+	int* transition;
+
+	//nombre d'états pour lesquels transition et accepteur sont alloués
+	int capacite;
+
+	//accepteur[i] vaut 1 si l'état déterministe i contient un état final
+	unsigned char* accepteur;
+
+	//taille maximale en octets du cache, au delà le cache est vidé
+	size_t memoireMax;
+
+	//nombre de fois où le cache a été vidé depuis la construction
+	int nbVidages;
+
+	//tampons de travail d'une case par état non déterministe
+	int* ensemble;
+	int* suivant;
+	int* marque;
+	int tampon;
+} AFDParesseux;
+
+//structure représentant un automate non déterministe simulé par vecteurs de bits
+//l'ensemble des états actifs est un vecteur de bits, un mot machine jusqu'à 64 états et nbMots mots machine au delà
+typedef struct AFNDBits
+{
+	//nombre d'états de l'automate simulé
+	int nbEtats;
+
+	//nombre de mots machine d'un vecteur d'états
+	int nbMots;
+
+	//classes de caractères de l'automate simulé
+	int nbClasses;
+	unsigned char classe[256];
+
+	//vecteurs des états initiaux et des états finaux
+	uint64_t* initial;
+	uint64_t* final;
+
+	//successeurs de chaque état par chaque classe : le vecteur des successeurs de l'état e par la classe k commence à l'indice (k*nbEtats+e)*nbMots
+	uint64_t* successeur;
+
+	//jusqu'à 64 états, successeurs de chaque groupe de 8 états pour chacune des 256 valeurs possibles de leurs bits :
+	//l'union des successeurs des états actifs par la classe k s'obtient en 8 lectures de la case (k*8+j)*256+octet j du vecteur
+	uint64_t* table;
+} AFNDBits;
+
+//blocs de travail restant à un thread du pool : il les prend par le début, les autres threads en volent la moitié par la fin
+typedef struct FileBlocs
+{
+	pthread_mutex_t verrou;
+	int debut;
+	int fin;
+} FileBlocs;
+
+//structure représentant un pool de threads qui se partagent les blocs d'une tâche par vol de travail
+typedef struct PoolThreads
+{
+	//nombre de threads du pool
+	int nbThreads;
+	pthread_t* threads;
+
+	//file de blocs de chaque thread
+	FileBlocs* files;
+
+	//protège les champs suivants
+	pthread_mutex_t verrou;
+
+	//signale une nouvelle tâche aux threads, puis la fin de la tâche à l'appelant
+	pthread_cond_t travail;
+	pthread_cond_t termine;
+
+	//numéro de la tâche en cours, incrémenté à chaque appel de executerParallele
+	int generation;
+
+	//nombre de threads qui n'ont pas encore terminé la tâche en cours
+	int actifs;
+
+	//booléen demandant l'arrêt des threads
+	int arret;
+
+	//tâche en cours : fonction appelée sur chaque intervalle [debut, fin[ d'éléments, son contexte, le nombre d'éléments et la taille d'un bloc
+	void (*tache)(void* contexte, int debut, int fin);
+	void* contexte;
+	int nbElements;
+	int tailleBloc;
+} PoolThreads;
+
+//argument de démarrage d'un thread du pool
+typedef struct ArgumentThread
+{
+	PoolThreads* pool;
+	int numero;
+} ArgumentThread;
+
+//structure représentant un noeud de l'arbre d'une expression rationnelle
+//les fils d'un noeud ont toujours un indice plus petit que lui
+typedef struct NoeudExpression
+{
+	//type du noeud, parmi les NOEUD_*
+	int type;
+
+	//indices des fils, -1 si absents
+	int gauche;
+	int droite;
+
+	//pour un noeud NOEUD_ENSEMBLE, ensemble des caractères reconnus : le caractère c est présent si le bit c%8 de ensemble[c/8] vaut 1
+	unsigned char ensemble[32];
+} NoeudExpression;
+
+//structure représentant l'analyse en cours d'une expression rationnelle
+typedef struct AnalyseurExpression
+{
+	//expression analysée et position du prochain caractère à lire
+	const char* expression;
+	int position;
+
+	//noeuds de l'arbre construits jusqu'ici
+	NoeudExpression* noeuds;
+	int nbNoeuds;
+	int capaciteNoeuds;
+} AnalyseurExpression;
+
+//structure représentant une liste de positions d'une expression rationnelle, dont la capacité double quand elle est pleine
+typedef struct ListePositions
+{
+	int* elements;
+	int taille;
+	int capacite;
+} ListePositions;
+
+//structure représentant un mot à reconnaître dans un lot de mots
+typedef struct Mot
+{
+	//caractères du mot, pas nécessairement terminés par '\0'
+	char* caracteres;
+
+	//nombre de caractères du mot
+	int longueur;
+} Mot;
+
+//structure représentant la lecture d'un mot arrivant par morceaux : seul l'état courant est conservé entre deux morceaux
+typedef struct FluxAFD
+{
+	AFD* automate;
+	int etat;
+} FluxAFD;
+
+//structure représentant une occurrence d'un mot du langage dans un texte, entre les positions debut incluse et fin exclue
+typedef struct Occurrence
+{
+	size_t debut;
+	size_t fin;
+} Occurrence;
+
+//structure représentant les automates déterministes minimaux utilisés pour chercher les mots d'un langage L dans un texte
+typedef struct Recherche
+{
+	//L, pour trouver la fin la plus longue depuis un début
+	AFD ancre;
+
+	//tous les mots suivis de L, pour trouver les fins d'occurrences en une passe vers l'avant
+	AFD avant;
+
+	//L inversé, pour remonter d'une fin vers les débuts
+	AFD arriere;
+
+	//tous les mots suivis de L inversé, pour trouver les débuts d'occurrences en une passe vers l'arrière
+	AFD arriereNonAncre;
+
+	//accepteur[e] vaut 1 si l'état e de l'automate correspondant est final
+	unsigned char* accepteurAncre;
+	unsigned char* accepteurAvant;
+	unsigned char* accepteurArriere;
+	unsigned char* accepteurArriereNonAncre;
+} Recherche;
+
+//contexte partagé par les blocs de reconnaitreLotParallele
+typedef struct ContexteLot
+{
+	Mot* mots;
+	AFD* automate;
+	unsigned char* accepteur;
+	unsigned char* resultats;
+} ContexteLot;
+
+//contexte partagé par les tronçons de est_reconnu_parallele
+typedef struct ContexteTroncons
+{
+	//texte découpé et sa longueur
+	char* texte;
+	size_t longueur;
+
+	//longueur de chaque tronçon, sauf du dernier qui s'arrête à la fin du texte
+	size_t tailleTroncon;
+
+	AFD* automate;
+
+	//carte de chaque tronçon : l'état atteint en fin du tronçon t depuis l'état e est cartes[t*nbEtats+e]
+	int* cartes;
+} ContexteTroncons;
+
+//structure représentant un automate minimal gardé par un cache de compilation
+typedef struct EntreeCache
+{
+	//description de l'automate non déterministe d'origine mise à plat, comparée en entier pour écarter les collisions d'empreinte
+	int* cle;
+	int tailleCle;
+
+	//empreinte de la description
+	unsigned long empreinte;
+
+	//automate minimal, toujours alloué par malloc quelle que soit l'arène de l'appelant
+	AFD minimal;
+
+	//place occupée par l'entrée en octets, décomptée du budget du cache
+	size_t taille;
+
+	//voisins dans la liste d'utilisation, de la plus récente à la plus ancienne, NULL aux extrémités
+	struct EntreeCache* plusRecente;
+	struct EntreeCache* plusAncienne;
+
+	//entrée suivante de la même alvéole de la table de hachage
+	struct EntreeCache* suivante;
+} EntreeCache;
+
+//structure représentant un cache qui associe à un automate non déterministe son automate déterministe minimal
+//les entrées les moins récemment utilisées sont retirées quand la place occupée dépasse memoireMax
+//toutes les opérations prennent le verrou, le cache peut donc être partagé entre plusieurs threads
+typedef struct CacheCompilation
+{
+	pthread_mutex_t verrou;
+
+	//table de hachage par chaînage, son nombre d'alvéoles est une puissance de 2 doublée quand elle a autant d'entrées
+	EntreeCache** alveoles;
+	int nbAlveoles;
+	int nbEntrees;
+
+	//extrémités de la liste d'utilisation
+	EntreeCache* plusRecente;
+	EntreeCache* plusAncienne;
+
+	//place occupée par les entrées et place maximale, en octets
+	size_t memoire;
+	size_t memoireMax;
+
+	//nombre de compilations trouvées dans le cache et nombre de compilations effectuées depuis sa création
+	long nbSucces;
+	long nbEchecs;
+} CacheCompilation;
+
+//structure représentant l'automate déterministe minimal d'un ensemble fini de mots, modifié mot par mot sans jamais être reconstruit
+//chaque état garde ses transitions triées par caractère, une transition par caractère, et le nombre de transitions qui y mènent
+//un registre range les états autres que l'initial selon leur finalité et leurs transitions : deux états de même description
+//reconnaissent les mêmes suffixes et sont confondus, ce qui garde l'automate minimal après chaque ajout ou retrait
+typedef struct DictionnaireAFD
+{
+	//nombre d'états alloués, libres compris, et nombre de cases allouées dans les tableaux indexés par état
+	int nbEtats;
+	int capaciteEtats;
+
+	//état initial, jamais rangé dans le registre ni confondu
+	int initial;
+
+	//transitions de chaque état triées par caractère, debut et fin valant le caractère, leur nombre et leur nombre de cases allouées
+	Arc** transition;
+	int* nbTransitions;
+	int* capaciteTransitions;
+
+	//final[e] vaut 1 si l'état e est final
+	unsigned char* final;
+
+	//nombre de transitions menant à chaque état : un état atteint par plusieurs transitions est copié avant d'être modifié
+	int* degre;
+
+	//enregistre[e] vaut 1 si l'état e est rangé dans le registre
+	unsigned char* enregistre;
+
+	//registre par chaînage, suivant[e] est l'état suivant de la même alvéole ou l'état libre suivant pour un état libre
+	int* alveoles;
+	int nbAlveoles;
+	int nbEnregistres;
+	int* suivant;
+
+	//premier état libre, -1 s'il n'y en a pas, et nombre d'états libres
+	int libre;
+	int nbLibres;
+
+	//nombre de mots reconnus
+	long nbMots;
+} DictionnaireAFD;
+
+//prépare une arène vide dont les blocs feront au moins tailleBloc octets, ou TAILLE_BLOC_ARENE si tailleBloc vaut 0
+void initialiserArene(Arene* arene, size_t tailleBloc);
+
+//rend d'un coup toute la mémoire distribuée par l'arène, qui garde son dernier bloc pour les allocations suivantes
+//tous les automates construits dans l'arène deviennent invalides
+void viderArene(Arene* arene);
+
+//libère tous les blocs de l'arène
+void detruireArene(Arene* arene);
+
+//fait de l'arène fournie l'arène courante du thread appelant et retourne la précédente, NULL revenant à malloc
+//les automates construits ensuite et les tableaux temporaires de leur construction sont pris dans l'arène courante,
+//desallouerAFND et desallouerAFD ne font alors plus rien sur ces automates
+void utiliserArene(Arene* arene, Arene** precedente);
+
 //valorise les nombres d'états, états initiaux et états finaux puis alloue les tableaux correspondants.
 void construireAFNDVierge(AFND* automate, int nbEtats, int nbEtatsInitiaux, int nbEtatsFinaux);
 
 //libère la mémoire allouée à un automate fini non déterministe
 void desallouerAFND(AFND* automate);
 
+//ajoute une transition de depart vers arrivee déclenchée par les caractères compris entre debut et fin inclus
+void ajouterTransitionAFND(AFND* automate, int depart, int arrivee, unsigned char debut, unsigned char fin);
+
+//ajoute une transition spontanée de depart vers arrivee, franchie sans lire de caractère
+//determiniser, l'automate paresseux et les vecteurs de bits suivent les transitions spontanées, supprimerEpsilonsAFND les retire
+void ajouterEpsilonAFND(AFND* automate, int depart, int arrivee);
+
+//attribue le numéro de motif fourni à tous les états finaux de l'automate
+//les automates de plusieurs motifs réunis par unionAFND ou unionAFNDEnPlace gardent chacun leur numéro, voir determiniserMotifs
+void attribuerMotifAFND(AFND* automate, int motif);
+
+//construit un automate équivalent sans transition spontanée, avec les mêmes états
+//chaque état reçoit les transitions et la finalité des états qu'il atteint spontanément, calculés en un parcours par état
+void supprimerEpsilonsAFND(AFND* automate, AFND* sansEpsilon);
+
 //construit un automate non déterministe reconnaissant le langage qui contient le seul mot vide
 void construireAFNDMotVide(AFND* automate);
 
@@ -62,34 +655,266 @@ void construireAFNDLangageVide(AFND* automate);
 //construit un automate non déterministe reconnaissant le langage qui contient un seul mot composé du caractère c sans répétition
 void construireAFNDLangageUnCar(AFND* automate, char c);
 
+//construit un automate non déterministe reconnaissant tous les mots
+void construireAFNDTousLesMots(AFND* automate);
+
+//construit en une passe l'automate de Glushkov de l'expression rationnelle fournie : un état initial plus un état par caractère ou classe de l'expression
+//accepte les caractères, ., les classes [a-z] et [^...], les échappements \n \t \r \d \w \s, |, *, +, ?, {m}, {m,}, {m,n} et les parenthèses
+//retourne faux sans rien allouer si l'expression est mal formée
+int construireAFNDExpression(const char* expression, AFND* automate);
+
 //construit un automate non déterministe reconnaissant l'union des langages des deux automates non déterministes en entrée
 void unionAFND(AFND* automate1, AFND* automate2, AFND* automate_union);
 
 //construit un automate non déterministe reconnaissant la concaténation des langages des deux automates non déterministes en entrée
+//les deux automates sont recopiés puis enchaînés comme par concatenationAFNDEnPlace
 void concatenationAFND(AFND* automate1, AFND* automate2, AFND* concatenation);
 
 //construit un automate non déterministe reconnaissant la fermeture itérative de Kleene du langage de l'automate non déterminisate en entrée
+//l'automate est recopié puis fermé comme par fermetureIterativeDeKleeneEnPlace
 void fermetureIterativeDeKleene(AFND* automate, AFND* fermeIterativement);
 
+//construit un automate non déterministe reconnaissant les mots du langage de l'automate en entrée lus à l'envers
+void inverserAFND(AFND* automate, AFND* inverse);
+
+//remplace automate1 par l'union des langages des deux automates, les états de automate2 étant repris sans recopier leurs transitions
+//automate2 est consommé : il ne doit plus être utilisé ni désalloué, les deux automates doivent venir de la même arène
+void unionAFNDEnPlace(AFND* automate1, AFND* automate2);
+
+//remplace automate1 par la concaténation des langages des deux automates, les états de automate2 étant repris sans recopier leurs transitions
+//un état de liaison reçoit une transition spontanée de chaque état final de automate1 et en envoie une vers chaque état initial de automate2
+//les états finaux de automate2 sans motif reprennent celui des états finaux de automate1 quand ils en portent tous le même
+//automate2 est consommé : il ne doit plus être utilisé ni désalloué, les deux automates doivent venir de la même arène
+void concatenationAFNDEnPlace(AFND* automate1, AFND* automate2);
+
+//remplace l'automate par sa fermeture itérative de Kleene à la manière de Thompson : un nouvel état, seul initial et seul final,
+//mène spontanément aux anciens états initiaux et les anciens états finaux y reviennent spontanément
+//le nouvel état porte le motif commun aux anciens états finaux, ceux d'un autre motif restent finaux
+void fermetureIterativeDeKleeneEnPlace(AFND* automate);
+
 //valorise les nombres d'états, états initiaux et états finaux puis alloue le tableau d'états finaux
+//chaque caractère forme sa propre classe
 void construireAFDVierge(AFD* automate, int nbEtats, int nbEtatsFinaux);
 
+//identique à construireAFDVierge mais les transitions sont indexées par les nbClasses classes de caractères données par classe
+void construireAFDViergeClasses(AFD* automate, int nbEtats, int nbEtatsFinaux, int nbClasses, unsigned char* classe);
+
+//calcule les classes de caractères d'un automate non déterministe et retourne leur nombre
+//deux caractères sont dans la même classe si ils déclenchent exactement les mêmes transitions
+//les classes sont numérotées dans l'ordre du premier caractère qui les compose
+int calculerClassesAFND(AFND* automate, unsigned char* classe);
+
+//regroupe en classes les caractères qui déclenchent les mêmes transitions dans un automate fini déterministe
+//l'automate est modifié en place et ne garde qu'une colonne de transitions par classe
+void compresserAFD(AFD* automate);
+
 //libère la mémoire allouée à un automate fini déterministe
 void desallouerAFD(AFD* automate);
 
 //déterminise un automate fini non déterministe
 void determiniser(AFND* nonDeter, AFD* deter);
 
+//déterminise un automate non déterministe en gardant pour chaque état l'ensemble des motifs de ses composants finaux
+//un automate sans motifs attribués reconnaît le seul motif 0, un état final de motif -1 rend son état déterministe final sans ajouter de motif
+void determiniserMotifs(AFND* nonDeter, AFDMotifs* deter);
+
+//minimise un automate à motifs par l'algorithme de Hopcroft sans jamais confondre deux états de motifs différents
+void minimiserMotifs(AFDMotifs* automate, AFDMotifs* minimal);
+
+//libère la mémoire allouée à un automate à motifs
+void desallouerAFDMotifs(AFDMotifs* automate);
+
+//lit le mot en une passe et retourne le nombre de motifs qui le reconnaissent, au sens de est_reconnu
+//*motifs pointe alors sur leurs numéros triés, rangés dans l'automate
+int motifsReconnus(char* mot, int longueurMot, AFDMotifs* automate, int** motifs);
+
 //retourne vrai si les deux états ont le même nombre de composantes et si chaque composante de l'état 1 est présente dans l'état 2
-//utilisé dans la fonction déterminiser
+//determiniser n'en a plus besoin car elle compare des ensembles triés retrouvés par hachage
 int est_meme_etat(int compEtat1, int compEtat2, int* tableEtat1, int* tableEtat2);
 
 //retourne vrai si le mot fourni est reconnu par l'automate fourni, retourne faux autrement
 int est_reconnu(char* mot, int longueurMot, AFD* automate);
 
+//identique à est_reconnu mais affiche chaque caractère lu, chaque transition empruntée et l'état accepteur éventuel
+//à réserver au débogage, l'affichage coûte bien plus cher que le parcours de l'automate
+int est_reconnu_trace(char* mot, int longueurMot, AFD* automate);
+
+//teste chacun des nbMots mots fournis sur l'automate sans aucun affichage
+//le bit i de resultats (octet i/8, bit i%8) est mis à 1 si le mot i est reconnu et à 0 sinon
+//resultats doit contenir au moins (nbMots+7)/8 octets
+void reconnaitreLot(Mot* mots, int nbMots, AFD* automate, unsigned char* resultats);
+
+//teste chaque ligne du tampon (mots séparés par '\n') sur l'automate et retourne le nombre de mots testés
+//les résultats sont rangés dans resultats comme pour reconnaitreLot, qui doit contenir au moins taille/8+1 octets
+//un '\n' final ne crée pas de mot vide supplémentaire
+int reconnaitreTampon(char* tampon, int taille, AFD* automate, unsigned char* resultats);
+
+//retourne le résultat du mot i d'un lot rempli par reconnaitreLot ou reconnaitreTampon
+int resultatLot(unsigned char* resultats, int i);
+
+//démarre un pool de nbThreads threads, ou d'un thread par processeur si nbThreads <= 0
+void creerPoolThreads(PoolThreads* pool, int nbThreads);
+
+//arrête les threads du pool et libère sa mémoire
+void detruirePoolThreads(PoolThreads* pool);
+
+//découpe [0, nbElements[ en blocs de tailleBloc éléments et appelle tache sur chacun depuis les threads du pool
+//retourne quand tous les blocs ont été traités, un seul appel à la fois par pool
+void executerParallele(PoolThreads* pool, int nbElements, int tailleBloc, void (*tache)(void* contexte, int debut, int fin), void* contexte);
+
+//comme reconnaitreLot, en répartissant les mots entre les threads du pool fourni
+//l'automate n'est que lu et aucune mémoire n'est allouée par mot
+void reconnaitreLotParallele(Mot* mots, int nbMots, AFD* automate, unsigned char* resultats, PoolThreads* pool);
+
+//comme est_reconnu pour un seul très long texte : le texte est découpé en tronçons lus en parallèle depuis tous les états,
+//puis les états atteints en fin de chaque tronçon sont enchaînés depuis l'état initial
+int est_reconnu_parallele(char* mot, size_t longueurMot, AFD* automate, PoolThreads* pool);
+
+//prépare la recherche des mots du langage de l'automate dans des textes
+void preparerRecherche(AFND* automate, Recherche* recherche);
+
+//libère la mémoire allouée à une recherche, l'automate d'origine n'est pas libéré
+void desallouerRecherche(Recherche* recherche);
+
+//cherche de gauche à droite les occurrences sans chevauchement les plus longues : à chaque position la plus à gauche où commence une occurrence,
+//l'occurrence la plus longue est retenue et la recherche reprend à sa fin (au caractère suivant si elle est vide)
+//range dans *occurrences un tableau alloué, à libérer par l'appelant, et retourne son nombre d'éléments
+size_t rechercherPlusLonguesAGauche(char* texte, size_t longueur, Recherche* recherche, Occurrence** occurrences);
+
+//cherche toutes les occurrences, chevauchantes ou non : tout couple debut <= fin tel que le texte entre debut et fin appartient au langage
+//les occurrences sont triées par fin croissante puis par début décroissant, leur nombre peut être quadratique en la longueur du texte
+//range dans *occurrences un tableau alloué, à libérer par l'appelant, et retourne son nombre d'éléments
+size_t rechercherToutes(char* texte, size_t longueur, Recherche* recherche, Occurrence** occurrences);
+
+//commence la lecture par morceaux d'un mot sur l'automate fourni
+void debuterFlux(FluxAFD* flux, AFD* automate);
+
+//lit le morceau suivant du mot, sans rien allouer
+void alimenterFlux(FluxAFD* flux, char* morceau, size_t taille);
+
+//retourne vrai si le mot lu jusqu'ici est reconnu, retourne faux autrement
+//le flux n'est pas modifié et peut encore être alimenté
+int terminerFlux(FluxAFD* flux);
+
+//lit le descripteur de fichier jusqu'à sa fin comme un seul mot, ou jusqu'à ce que le mot soit rejeté
+//retourne vrai si le mot est reconnu, faux s'il ne l'est pas et -1 en cas d'erreur de lecture
+int reconnaitreDescripteur(int descripteur, AFD* automate);
+
+//projette le fichier en mémoire et le lit comme un seul mot
+//retourne vrai si le mot est reconnu, faux s'il ne l'est pas et -1 si le fichier ne peut être ouvert ou projeté
+int reconnaitreFichier(const char* chemin, AFD* automate);
+
+//compile un automate fini déterministe sous forme compacte, l'automate d'origine n'est pas modifié
+//une transition absente mène à un état mort ajouté après les autres, marqué ETAT_MORT comme tout état qui ne mène à aucun
+//état final ; les états depuis lesquels tous les mots sont reconnus sont marqués ETAT_UNIVERSEL
+void compilerAFD(AFD* automate, AFDCompact* compact);
+
+//libère la mémoire allouée à un automate compact, ou libère la projection d'un automate chargé par chargerAFDCompact
+void desallouerAFDCompact(AFDCompact* compact);
+
+//écrit dans sortie un fichier C autonome définissant int nom(const char* mot, size_t longueurMot), spécialisé pour l'automate fourni
+//et qui reconnaît les mêmes mots que est_reconnu sur cet automate, en s'arrêtant dès que la suite du mot ne change plus le résultat
+//forme vaut GENERATION_GOTO pour un état par étiquette et un switch par classe, GENERATION_TABLE pour une table constante,
+//préférable quand le nombre d'états fois le nombre de classes est grand
+void genererCodeC(AFD* automate, const char* nom, int forme, FILE* sortie);
+
+//écrit l'automate compact dans un fichier, retourne faux si le fichier ne peut être écrit
+int enregistrerAFDCompact(AFDCompact* compact, const char* chemin);
+
+//projette en mémoire un fichier écrit par enregistrerAFDCompact : la table de transitions et les drapeaux sont lus sur place,
+//sans copie, et les processus qui chargent le même fichier partagent les mêmes pages
+//retourne faux si le fichier ne peut être projeté, n'est pas un automate compact, vient d'une autre version ou d'une machine d'un autre ordre d'octets
+//seule l'entête est vérifiée, le fichier doit venir d'une source de confiance
+int chargerAFDCompact(const char* chemin, AFDCompact* compact);
+
+//retourne vrai si le mot fourni est reconnu par l'automate compact fourni, retourne faux autrement
+//les états que peu d'octets font quitter sont traversés par recherche vectorielle, la lecture s'arrête sur un état mort ou universel
+int est_reconnu_compact(char* mot, int longueurMot, AFDCompact* compact);
+
 //minimise un automate fini déterministe
+//les états depuis lesquels aucun état final n'est accessible sont retirés, leurs transitions devenant absentes
 void minimiser(AFD* automate, AFD* minimal);
 
+//minimise un automate fini déterministe par l'algorithme de raffinement de partition de Hopcroft en O(n log n)
+//produit exactement le même automate minimal que minimiser, numérotation des états comprise
+void minimiserHopcroft(AFD* automate, AFD* minimal);
+
+//construisent l'automate minimal des mots reconnus par les deux automates, par le premier mais pas le second,
+//par un seul des deux ou par au moins l'un des deux, au sens de est_reconnu
+//seuls les couples d'états accessibles depuis le couple initial sont construits, les automates d'origine ne sont pas modifiés
+void intersectionAFD(AFD* automate1, AFD* automate2, AFD* intersection);
+void differenceAFD(AFD* automate1, AFD* automate2, AFD* difference);
+void differenceSymetriqueAFD(AFD* automate1, AFD* automate2, AFD* differenceSymetrique);
+void unionAFD(AFD* automate1, AFD* automate2, AFD* automate_union);
+
+//construit l'automate minimal des mots que l'automate fourni ne reconnaît pas, au sens de est_reconnu
+void complementAFD(AFD* automate, AFD* complement);
+
+//prépare la reconnaissance paresseuse d'un automate non déterministe sans le déterminiser
+//le cache d'états déterministes n'occupe jamais beaucoup plus de memoireMax octets
+void construireAFDParesseux(AFND* automate, size_t memoireMax, AFDParesseux* paresseux);
+
+//libère la mémoire allouée à un automate paresseux, l'automate non déterministe n'est pas libéré
+void desallouerAFDParesseux(AFDParesseux* paresseux);
+
+//prépare la simulation par vecteurs de bits d'un automate non déterministe d'au plus AFND_BITS_MAX états
+//retourne faux sans rien allouer si l'automate a trop d'états
+int construireAFNDBits(AFND* automate, AFNDBits* bits);
+
+//libère la mémoire allouée à une simulation par vecteurs de bits
+void desallouerAFNDBits(AFNDBits* bits);
+
+//retourne vrai si le mot fourni est reconnu par la simulation fournie, retourne faux autrement
+//ne modifie pas la simulation et peut donc être appelée depuis plusieurs threads à la fois
+int est_reconnu_bits(char* mot, int longueurMot, AFNDBits* bits);
+
+//retourne vrai si le mot fourni est reconnu par l'automate paresseux fourni, retourne faux autrement
+//les états déterministes manquants sont calculés au fil de la lecture, si le cache doit être vidé trop souvent
+//la fin du mot est lue en simulant directement l'automate non déterministe, en temps linéaire et sans mémoire supplémentaire
+int est_reconnu_paresseux(char* mot, int longueurMot, AFDParesseux* paresseux);
+
+//prépare un cache de compilation vide d'au plus memoireMax octets, ou TAILLE_CACHE_COMPILATION si memoireMax vaut 0
+void initialiserCacheCompilation(CacheCompilation* cache, size_t memoireMax);
+
+//libère toutes les entrées du cache, les automates déjà rendus par compilerAFNDCache restent valides
+void detruireCacheCompilation(CacheCompilation* cache);
+
+//construit dans minimal l'automate déterministe minimal de l'automate fourni, comme determiniser suivi de minimiserHopcroft
+//le résultat est gardé dans le cache, un automate de même structure est ensuite compilé par une simple recopie
+//cache vaut NULL pour le cache partagé par tout le processus ; minimal vient de l'arène courante et appartient à l'appelant
+void compilerAFNDCache(AFND* automate, CacheCompilation* cache, AFD* minimal);
+
+//prépare un dictionnaire ne reconnaissant aucun mot
+void construireDictionnaireVide(DictionnaireAFD* dictionnaire);
+
+//prépare un dictionnaire reconnaissant les mots de l'automate fourni, qui n'a pas besoin d'être minimal
+//retourne faux sans rien allouer si l'automate reconnaît une infinité de mots, voir alors ajouterMotAFD et retirerMotAFD
+int construireDictionnaireAFD(AFD* automate, DictionnaireAFD* dictionnaire);
+
+//libère la mémoire allouée à un dictionnaire
+void desallouerDictionnaire(DictionnaireAFD* dictionnaire);
+
+//ajoute le mot au dictionnaire en O(longueurMot) opérations sur le registre, l'automate restant minimal
+//retourne faux si le mot était déjà reconnu
+int ajouterMotDictionnaire(DictionnaireAFD* dictionnaire, char* mot, int longueurMot);
+
+//retire le mot du dictionnaire en O(longueurMot) opérations sur le registre, l'automate restant minimal
+//retourne faux si le mot n'était pas reconnu
+int retirerMotDictionnaire(DictionnaireAFD* dictionnaire, char* mot, int longueurMot);
+
+//retourne vrai si le mot fourni est reconnu par le dictionnaire, retourne faux autrement
+int est_reconnu_dictionnaire(char* mot, int longueurMot, DictionnaireAFD* dictionnaire);
+
+//construit l'automate minimal du dictionnaire, les états étant numérotés dans l'ordre d'un parcours en largeur depuis l'état initial
+void convertirDictionnaireAFD(DictionnaireAFD* dictionnaire, AFD* automate);
+
+//construisent l'automate minimal des mots de l'automate fourni auxquels le mot est ajouté ou dont il est retiré, pour un langage quelconque
+//seuls les couples d'un état de l'automate et d'une position dans le mot accessibles sont construits, comme par unionAFD et differenceAFD
+void ajouterMotAFD(AFD* automate, char* mot, int longueurMot, AFD* resultat);
+void retirerMotAFD(AFD* automate, char* mot, int longueurMot, AFD* resultat);
+
+//la fonction main peut être retirée en définissant AUTOMATO_SANS_MAIN, pour inclure ce fichier dans un autre programme comme bench.c
+#ifndef AUTOMATO_SANS_MAIN
 int main(int argc, char const *argv[])
 {
 
@@ -114,7 +939,7 @@ int main(int argc, char const *argv[])
 	determiniser(&etoile3c_d,&deter_etoile3c_d);
 	minimiser(&deter_etoile3c_d,&mini_etoile3c_d);
 
-	if(est_reconnu("d3cdd3c3c",9,&mini_etoile3c_d))
+	if(est_reconnu_trace("d3cdd3c3c",9,&mini_etoile3c_d))
 	{
 		printf("premier mot reconnu\n");
 	}
@@ -123,7 +948,7 @@ int main(int argc, char const *argv[])
 		printf(" premier mot non reconnu\n");
 	}
 
-	if(est_reconnu("d3cdd3ch3c",10,&mini_etoile3c_d))
+	if(est_reconnu_trace("d3cdd3ch3c",10,&mini_etoile3c_d))
 	{
 		printf("second mot reconnu\n");
 	}
@@ -143,102 +968,301 @@ int main(int argc, char const *argv[])
 
 	return 0;
 }
+#endif
 
-void construireAFNDVierge(AFND* automate, int nbEtats, int nbEtatsInitiaux, int nbEtatsFinaux)
+//arène courante de chaque thread, NULL tant que utiliserArene n'a pas été appelée
+static _Thread_local Arene* areneCourante = NULL;
+
+//chaque allocation d'arène est précédée de sa taille, sur 16 octets pour garder l'alignement
+#define ENTETE_ARENE 16
+
+void initialiserArene(Arene* arene, size_t tailleBloc)
 {
-	//on initialise le nombre d'états
-	automate->nbEtats = nbEtats;
-	//on alloue la première dimension du tableau de transitions
-	automate->transition = malloc(sizeof(int**)*automate->nbEtats);
+	arene->bloc = NULL;
+	arene->tailleBloc = tailleBloc ? tailleBloc : TAILLE_BLOC_ARENE;
+	arene->derniere = NULL;
+}
 
-	//on alloue la seconde dimension du tableau de transitions
-	for (int i = 0; i < automate->nbEtats; i++)
-	{
-		automate->transition[i] = malloc(sizeof(int*)*automate->nbEtats);
-	}
+void viderArene(Arene* arene)
+{
+	BlocArene* precedent;
 
-	//on alloue la première dimension du tableau contenant le nombre de transition pour chaque paire
-	automate->nbTransitions = malloc(sizeof(int*)*automate->nbEtats);
-	
-	//on alloue la seconde dimension et on initialise le nombre de transitions entre chaque paire à 0
-	for (int i = 0; i < automate->nbEtats; i++)
+	//seul le bloc courant est gardé
+	if(arene->bloc != NULL)
 	{
-		automate->nbTransitions[i] = malloc(sizeof(int*)*automate->nbEtats);
-		for (int j = 0; j < automate->nbEtats; j++)
+		while(arene->bloc->precedent != NULL)
 		{
-			automate->nbTransitions[i][j] = 0;
+			precedent = arene->bloc->precedent->precedent;
+			free(arene->bloc->precedent);
+			arene->bloc->precedent = precedent;
 		}
+		arene->bloc->utilise = 0;
 	}
+	arene->derniere = NULL;
+}
 
-	//on initialise le nombre d'états initiaux et on alloue le tableau à la taille donnée
-	automate->nbEtatsInitiaux = nbEtatsInitiaux;
-	automate->initial = malloc(sizeof(int)*automate->nbEtatsInitiaux);
+void detruireArene(Arene* arene)
+{
+	BlocArene* precedent;
 
-	//on initialise le nombre d'états finaux et on alloue le tableau à la taille donnée
-	automate->nbEtatsFinaux = nbEtatsFinaux;
-	automate->final = malloc(sizeof(int)*automate->nbEtatsFinaux);
+	while(arene->bloc != NULL)
+	{
+		precedent = arene->bloc->precedent;
+		free(arene->bloc);
+		arene->bloc = precedent;
+	}
+	arene->derniere = NULL;
 }
 
-void desallouerAFND(AFND* automate)
+void utiliserArene(Arene* arene, Arene** precedente)
 {
-	int i,j,k;
-
-	//pour chaque paire d'états i et j
-	for(i = 0; i < automate->nbEtats; i++){
-		for(j = 0; j < automate->nbEtats; j++){
-			//si il y a des transitions de i à j 
-			if(automate->nbTransitions[i][j] > 0){
-				//on libère la mémoire dédiée à ces transitions
-				free(automate->transition[i][j]);
-			}
-		}
-		//on libère la mémoire dédié aux secondes dimensions des tableaux de transitions et nombres de transitions
-		free(automate->nbTransitions[i]);
-		free(automate->transition[i]);
+	if(precedente != NULL)
+	{
+		*precedente = areneCourante;
 	}
+	areneCourante = arene;
+}
 
-	//ainsi que la première dimension
-	free(automate->nbTransitions);
-	free(automate->transition);
-	//on libère également les tableaux d'états initiaux et finaux
-	free(automate->initial);
-	free(automate->final);
+//retourne la taille d'une allocation d'arène, rangée juste avant elle
+static size_t tailleAllocationArene(void* pointeur)
+{
+	return *(size_t*)((char*)pointeur - ENTETE_ARENE);
 }
 
-void construireAFNDMotVide(AFND* automate)
+//alloue taille octets dans l'arène fournie, ou avec malloc si elle vaut NULL
+static void* allouerArene(Arene* arene, size_t taille)
 {
-	//on constuit notre AFND en connaissant déjà le nombre d'états nécessaires
-	construireAFNDVierge(automate, 2, 1, 1);
+	//nouveau bloc si le bloc courant est plein
+	BlocArene* bloc;
 
-	//0 est initial et final
-	automate->initial[0] = 0;
-	automate->final[0] = 0;
+	//place occupée par l'allocation, entête compris
+	size_t place;
 
-	//256 transitions de 0 à 1 car on transitionne vers 1 pour tout l'alphabet
-	automate->nbTransitions[0][1] = 256;
+	//adresse de l'allocation
+	char* pointeur;
 
-	//on alloue le tableau des transitions
-	automate->transition[0][1] = malloc(sizeof(int)*automate->nbTransitions[0][1]);
+	if(arene == NULL)
+	{
+		return malloc(taille);
+	}
 
-	//on ajoute une transition de 0 à 1 pour chaque caractère de l'alphabet
-	for (int i = 0; i < automate->nbTransitions[0][1] ; i++)
+	taille = (taille + ENTETE_ARENE - 1) / ENTETE_ARENE * ENTETE_ARENE;
+	place = taille + ENTETE_ARENE;
+	if(arene->bloc == NULL || arene->bloc->utilise + place > arene->bloc->taille)
 	{
-		automate->transition[0][1][i] = i;
+		//une allocation plus grande qu'un bloc reçoit un bloc à sa taille
+		bloc = malloc(ENTETE_ARENE*2 + (place > arene->tailleBloc ? place : arene->tailleBloc));
+		bloc->taille = place > arene->tailleBloc ? place : arene->tailleBloc;
+		bloc->utilise = 0;
+		bloc->precedent = arene->bloc;
+		arene->bloc = bloc;
 	}
+
+	//les données d'un bloc commencent 32 octets après lui, ce qui couvre la structure du bloc
+	pointeur = (char*)arene->bloc + ENTETE_ARENE*2 + arene->bloc->utilise;
+	*(size_t*)pointeur = taille;
+	arene->bloc->utilise += place;
+	arene->derniere = pointeur + ENTETE_ARENE;
+	return arene->derniere;
 }
 
-void construireAFNDLangageVide(AFND* automate)
+//comme allouerArene avec une mémoire remise à zéro, une arène vidée rendant des octets déjà utilisés
+static void* allouerZeroArene(Arene* arene, size_t nombre, size_t taille)
 {
-	//on construit un automate à 1 état initial mais pas accepteur
-	construireAFNDVierge(automate, 1, 1, 0);
+	void* pointeur;
 
-	//0 est initial
-	automate->initial[0] = 0;
+	if(arene == NULL)
+	{
+		return calloc(nombre, taille);
+	}
+	pointeur = allouerArene(arene, nombre*taille);
+	memset(pointeur, 0, nombre*taille);
+	return pointeur;
+}
+
+//agrandit une allocation de l'arène fournie, sur place si c'est la dernière et que le bloc a la place
+static void* reallouerArene(Arene* arene, void* pointeur, size_t taille)
+{
+	//ancienne taille arrondie et nouvelle taille arrondie
+	size_t ancienne,nouvelle;
+
+	//nouvelle allocation
+	void* copie;
+
+	if(arene == NULL)
+	{
+		return realloc(pointeur, taille);
+	}
+	if(pointeur == NULL)
+	{
+		return allouerArene(arene, taille);
+	}
+
+	ancienne = tailleAllocationArene(pointeur);
+	if(taille <= ancienne)
+	{
+		return pointeur;
+	}
+	nouvelle = (taille + ENTETE_ARENE - 1) / ENTETE_ARENE * ENTETE_ARENE;
+	if(pointeur == arene->derniere && arene->bloc->utilise + nouvelle - ancienne <= arene->bloc->taille)
+	{
+		arene->bloc->utilise += nouvelle - ancienne;
+		*(size_t*)((char*)pointeur - ENTETE_ARENE) = nouvelle;
+		return pointeur;
+	}
+
+	copie = allouerArene(arene, taille);
+	memcpy(copie, pointeur, ancienne);
+	return copie;
+}
+
+//rend une allocation de l'arène fournie : seule la dernière allocation est effectivement rendue, les autres attendent l'arène
+static void libererArene(Arene* arene, void* pointeur)
+{
+	if(arene == NULL)
+	{
+		free(pointeur);
+		return;
+	}
+	if(pointeur != NULL && pointeur == arene->derniere)
+	{
+		arene->bloc->utilise -= tailleAllocationArene(pointeur) + ENTETE_ARENE;
+		arene->derniere = NULL;
+	}
+}
+
+void construireAFNDVierge(AFND* automate, int nbEtats, int nbEtatsInitiaux, int nbEtatsFinaux)
+{
+	//l'automate est construit dans l'arène courante
+	automate->arene = areneCourante;
+
+	//on initialise le nombre d'états
+	automate->nbEtats = nbEtats;
+	automate->capaciteEtats = nbEtats;
+
+	//chaque état part sans aucune transition, les tableaux de transitions sont alloués au premier ajout
+	automate->nbTransitions = allouerZeroArene(automate->arene, automate->nbEtats, sizeof(int));
+	automate->capaciteTransitions = allouerZeroArene(automate->arene, automate->nbEtats, sizeof(int));
+	automate->transition = allouerZeroArene(automate->arene, automate->nbEtats, sizeof(Arc*));
+	automate->nbEpsilons = allouerZeroArene(automate->arene, automate->nbEtats, sizeof(int));
+	automate->capaciteEpsilons = allouerZeroArene(automate->arene, automate->nbEtats, sizeof(int));
+	automate->epsilon = allouerZeroArene(automate->arene, automate->nbEtats, sizeof(int*));
+	automate->motif = NULL;
+
+	//on initialise le nombre d'états initiaux et on alloue le tableau à la taille donnée
+	automate->nbEtatsInitiaux = nbEtatsInitiaux;
+	automate->capaciteInitiaux = nbEtatsInitiaux;
+	automate->initial = allouerArene(automate->arene, sizeof(int)*automate->nbEtatsInitiaux);
+
+	//on initialise le nombre d'états finaux et on alloue le tableau à la taille donnée
+	automate->nbEtatsFinaux = nbEtatsFinaux;
+	automate->capaciteFinaux = nbEtatsFinaux;
+	automate->final = allouerArene(automate->arene, sizeof(int)*automate->nbEtatsFinaux);
+}
+
+void desallouerAFND(AFND* automate)
+{
+	int i;
+
+	//la mémoire d'un automate construit dans une arène n'est rendue qu'avec l'arène
+	if(automate->arene != NULL)
+	{
+		return;
+	}
+
+	//on libère les tableaux de transitions de chaque état
+	for(i = 0; i < automate->nbEtats; i++){
+		libererArene(automate->arene, automate->transition[i]);
+		libererArene(automate->arene, automate->epsilon[i]);
+	}
+
+	//ainsi que les tableaux indexés par état
+	libererArene(automate->arene, automate->nbTransitions);
+	libererArene(automate->arene, automate->capaciteTransitions);
+	libererArene(automate->arene, automate->transition);
+	libererArene(automate->arene, automate->nbEpsilons);
+	libererArene(automate->arene, automate->capaciteEpsilons);
+	libererArene(automate->arene, automate->epsilon);
+	libererArene(automate->arene, automate->motif);
+	//on libère également les tableaux d'états initiaux et finaux
+	libererArene(automate->arene, automate->initial);
+	libererArene(automate->arene, automate->final);
+}
+
+void ajouterTransitionAFND(AFND* automate, int depart, int arrivee, unsigned char debut, unsigned char fin)
+{
+	//nouvelle transition
+	Arc* arc;
+
+	//si le tableau de l'état de départ est plein on double sa taille pour que les ajouts successifs restent en temps constant amorti
+	if(automate->nbTransitions[depart] == automate->capaciteTransitions[depart])
+	{
+		if(automate->capaciteTransitions[depart] == 0)
+		{
+			automate->capaciteTransitions[depart] = 2;
+		}
+		else
+		{
+			automate->capaciteTransitions[depart] *= 2;
+		}
+		automate->transition[depart] = reallouerArene(automate->arene, automate->transition[depart], sizeof(Arc)*automate->capaciteTransitions[depart]);
+	}
+
+	arc = &automate->transition[depart][automate->nbTransitions[depart]];
+	arc->arrivee = arrivee;
+	arc->debut = debut;
+	arc->fin = fin;
+	automate->nbTransitions[depart]++;
+}
+
+void ajouterEpsilonAFND(AFND* automate, int depart, int arrivee)
+{
+	//comme pour les transitions, la capacité double quand le tableau de l'état de départ est plein
+	if(automate->nbEpsilons[depart] == automate->capaciteEpsilons[depart])
+	{
+		if(automate->capaciteEpsilons[depart] == 0)
+		{
+			automate->capaciteEpsilons[depart] = 2;
+		}
+		else
+		{
+			automate->capaciteEpsilons[depart] *= 2;
+		}
+		automate->epsilon[depart] = reallouerArene(automate->arene, automate->epsilon[depart], sizeof(int)*automate->capaciteEpsilons[depart]);
+	}
+
+	automate->epsilon[depart][automate->nbEpsilons[depart]] = arrivee;
+	automate->nbEpsilons[depart]++;
+}
+
+void construireAFNDMotVide(AFND* automate)
+{
+	//on constuit notre AFND en connaissant déjà le nombre d'états nécessaires
+	construireAFNDVierge(automate, 2, 1, 1);
+
+	//0 est initial et final
+	automate->initial[0] = 0;
+	automate->final[0] = 0;
+
+	//on transitionne de 0 à 1 pour tout l'alphabet
+	ajouterTransitionAFND(automate, 0, 1, 0, 255);
+}
+
+void construireAFNDLangageVide(AFND* automate)
+{
+	//on construit un automate à 1 état initial mais pas accepteur
+	construireAFNDVierge(automate, 1, 1, 0);
+
+	//0 est initial
+	automate->initial[0] = 0;
 }
 
 void construireAFNDLangageUnCar(AFND* automate, char c)
 {
-	int i,j;
+	//le caractère est manipulé comme non signé pour couvrir les 256 caractères
+	unsigned char car;
+
+	car = c;
 
 	//remplissage des valeurs triviales
 	construireAFNDVierge(automate, 3, 1, 1);
@@ -249,57 +1273,64 @@ void construireAFNDLangageUnCar(AFND* automate, char c)
 	//état final
 	automate->final[0] = 1;
 	
-	//nombre de transitions par couple d'états
-	//on a une transition de 0 à 1 (par c), 255 de 0 à 2 (par tous les caractères ASCII sauf c) et 256 transitions de 1 à 2 (par tous les caractères ASCII)
-	automate->nbTransitions[0][0] = 0;
-	automate->nbTransitions[0][1] = 1;
-	automate->nbTransitions[0][2] = 255;
-
-	automate->nbTransitions[1][0] = 0;
-	automate->nbTransitions[1][1] = 0;
-	automate->nbTransitions[1][2] = 256;
-
-	automate->nbTransitions[2][0] = 0;
-	automate->nbTransitions[2][1] = 0;
-	automate->nbTransitions[2][2] = 0;
-
-	//allocation des tableaux de transitions là où il en existe
-	automate->transition[0][1] = malloc(sizeof(int*)*automate->nbTransitions[0][1]);
-	automate->transition[0][2] = malloc(sizeof(int*)*automate->nbTransitions[0][2]);
-	automate->transition[1][2] = malloc(sizeof(int*)*automate->nbTransitions[1][2]);
-	
-
-	//la transition de 0 à 1 se fait par c, on met donc c dans la seule case de transition[0][1][0]
-	automate->transition[0][1][0] = c;
+	//on a une transition de 0 à 1 par c, de 0 à 2 par tous les autres caractères et de 1 à 2 par tous les caractères
+	ajouterTransitionAFND(automate, 0, 1, car, car);
 
-	//on met tous les caractères ASCII sauf dans les transitions de 0 vers 2 
-	j = 0;
-	for (i = 0; i < automate->nbTransitions[0][2]; i++)
+	//les caractères autres que c forment au plus deux intervalles, avant et après c
+	if(car > 0)
 	{
-		if (i != c)
-		{
-			automate->transition[0][2][j] = i;
-			j++;
-		}
+		ajouterTransitionAFND(automate, 0, 2, 0, car - 1);
 	}
-
-	//on met un caractère ASCII différent dans chaque case de transition[1][2] jusqu'à ce que tous les caractères ASCII y soient
-	for (i = 0; i < automate->nbTransitions[1][2]; i++)
+	if(car < 255)
 	{
-		//le fait que la case i contiennet i n'est pas significatif
-		//il importe seulement que le tableau de 256 cases contienne les 256 caractères peu importe leur ordre
-		automate->transition[1][2][i] = i;
+		ajouterTransitionAFND(automate, 0, 2, car + 1, 255);
 	}
 
+	ajouterTransitionAFND(automate, 1, 2, 0, 255);
+}
+
+//construit une copie de l'automate dans l'arène courante, chaque tableau de transitions étant alloué à sa taille exacte
+static void copierAFND(AFND* automate, AFND* copie)
+{
+	//compteur de boucle
+	int i;
+
+	construireAFNDVierge(copie, automate->nbEtats, automate->nbEtatsInitiaux, automate->nbEtatsFinaux);
+	memcpy(copie->initial, automate->initial, sizeof(int)*automate->nbEtatsInitiaux);
+	memcpy(copie->final, automate->final, sizeof(int)*automate->nbEtatsFinaux);
+	if(automate->motif != NULL)
+	{
+		copie->motif = allouerArene(copie->arene, sizeof(int)*(automate->nbEtats + 1));
+		memcpy(copie->motif, automate->motif, sizeof(int)*automate->nbEtats);
+	}
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		if(automate->nbTransitions[i] > 0)
+		{
+			copie->transition[i] = allouerArene(copie->arene, sizeof(Arc)*automate->nbTransitions[i]);
+			memcpy(copie->transition[i], automate->transition[i], sizeof(Arc)*automate->nbTransitions[i]);
+			copie->nbTransitions[i] = automate->nbTransitions[i];
+			copie->capaciteTransitions[i] = automate->nbTransitions[i];
+		}
+		if(automate->nbEpsilons[i] > 0)
+		{
+			copie->epsilon[i] = allouerArene(copie->arene, sizeof(int)*automate->nbEpsilons[i]);
+			memcpy(copie->epsilon[i], automate->epsilon[i], sizeof(int)*automate->nbEpsilons[i]);
+			copie->nbEpsilons[i] = automate->nbEpsilons[i];
+			copie->capaciteEpsilons[i] = automate->nbEpsilons[i];
+		}
+	}
 }
 
 void unionAFND(AFND* automate1, AFND* automate2, AFND* automate_union)
 {
-	int i,j,k;
+	int i,k;
+	Arc* arc;
+
 	construireAFNDVierge(automate_union, automate1->nbEtats + automate2->nbEtats, automate1->nbEtatsInitiaux + automate2->nbEtatsInitiaux, automate1->nbEtatsFinaux + automate2->nbEtatsFinaux);
 
 	//ajout des états initiaux des automates 1 et 2, les uns à la suite des autres
-	for (i = 0; i < automate_union->nbEtatsInitiaux; i++)
+	for (i = 0; i < automate1->nbEtatsInitiaux; i++)
 	{
 		automate_union->initial[i] = automate1->initial[i];
 	}
@@ -311,7 +1342,7 @@ void unionAFND(AFND* automate1, AFND* automate2, AFND* automate_union)
 
 
 	//ajout des états finaux des automates 1 et 2, les uns à la suite des autres
-	for (i = 0; i < automate_union->nbEtatsFinaux; i++)
+	for (i = 0; i < automate1->nbEtatsFinaux; i++)
 	{
 		automate_union->final[i] = automate1->final[i];
 	}
@@ -321,459 +1352,561 @@ void unionAFND(AFND* automate1, AFND* automate2, AFND* automate_union)
 		automate_union->final[i] = automate2->final[i-automate1->nbEtatsFinaux] + automate1->nbEtats;
 	}
 
+	//les motifs des deux automates sont conservés, un état sans motif recevant -1
+	if(automate1->motif != NULL || automate2->motif != NULL)
+	{
+		automate_union->motif = allouerArene(automate_union->arene, sizeof(int)*(automate_union->nbEtats + 1));
+		for (i = 0; i < automate1->nbEtats; i++)
+		{
+			automate_union->motif[i] = automate1->motif != NULL ? automate1->motif[i] : -1;
+		}
+		for (i = 0; i < automate2->nbEtats; i++)
+		{
+			automate_union->motif[i + automate1->nbEtats] = automate2->motif != NULL ? automate2->motif[i] : -1;
+		}
+	}
+
 	//ajout des transitions de l'automate 1
 	for (i = 0; i < automate1->nbEtats; i++)
 	{
-		for (j = 0; j < automate1->nbEtats; j++)
+		for (k = 0; k < automate1->nbTransitions[i]; k++)
 		{
-			automate_union->nbTransitions[i][j] = automate1->nbTransitions[i][j];
-			if(automate_union->nbTransitions[i][j] > 0)
-			{
-				automate_union->transition[i][j] = malloc(sizeof(int)*automate_union->nbTransitions[i][j]);
-			}
-
-			for (k = 0; k < automate_union->nbTransitions[i][j]; k++)
-			{
-				automate_union->transition[i][j][k] = automate1->transition[i][j][k];
-			}
+			arc = &automate1->transition[i][k];
+			ajouterTransitionAFND(automate_union, i, arc->arrivee, arc->debut, arc->fin);
+		}
+		for (k = 0; k < automate1->nbEpsilons[i]; k++)
+		{
+			ajouterEpsilonAFND(automate_union, i, automate1->epsilon[i][k]);
 		}
 	}
 
-	//ajout des transitions de l'automate 2
-	for (i = automate1->nbEtats; i < automate1->nbEtats + automate2->nbEtats; i++)
+	//ajout des transitions de l'automate 2 en décalant les états du nombre d'états de l'automate 1
+	for (i = 0; i < automate2->nbEtats; i++)
 	{
-		for (j = automate1->nbEtats; j < automate1->nbEtats + automate2->nbEtats; j++)
+		for (k = 0; k < automate2->nbTransitions[i]; k++)
 		{
-			automate_union->nbTransitions[i][j] = automate2->nbTransitions[i - automate1->nbEtats][j - automate1->nbEtats];
-			if(automate_union->nbTransitions[i][j] > 0)
-			{
-				automate_union->transition[i][j] = malloc(sizeof(int)*automate_union->nbTransitions[i][j]);
-			}
-
-			for (k = 0; k < automate_union->nbTransitions[i][j]; k++)
-			{
-				automate_union->transition[i][j][k] = automate2->transition[i - automate1->nbEtats][j - automate1->nbEtats][k];
-			}
+			arc = &automate2->transition[i][k];
+			ajouterTransitionAFND(automate_union, i + automate1->nbEtats, arc->arrivee + automate1->nbEtats, arc->debut, arc->fin);
+		}
+		for (k = 0; k < automate2->nbEpsilons[i]; k++)
+		{
+			ajouterEpsilonAFND(automate_union, i + automate1->nbEtats, automate2->epsilon[i][k] + automate1->nbEtats);
 		}
 	}
 }
 
 void concatenationAFND(AFND* automate1, AFND* automate2, AFND* concatenation)
 {
-	//booléens utilisés pour vérifier si un état est initial ou final
-	int initial;
-	int final;
+	//copie de automate2, consommée par la concaténation en place
+	AFND copie2;
 
-	//compteur indiquant le nombre d'états à la fois finaux et initiaux
-	int finalInitial;
+	//les deux copies viennent de l'arène courante, l'enchaînement se fait par transitions spontanées sans recopier celles des états initiaux
+	copierAFND(automate1, concatenation);
+	copierAFND(automate2, &copie2);
+	concatenationAFNDEnPlace(concatenation, &copie2);
+}
 
-	//nombre d'états finaux dans le nouvel automate
-	int nbEtatsFinaux;
+void fermetureIterativeDeKleene(AFND* automate, AFND* fermeIterativement)
+{
+	copierAFND(automate, fermeIterativement);
+	fermetureIterativeDeKleeneEnPlace(fermeIterativement);
+}
 
-	//compteurs de boucle
-	int i,j,k,l,m,n,o;
+void construireAFDVierge(AFD* automate, int nbEtats, int nbEtatsFinaux)
+{
+	//classe de chaque caractère, ici le caractère lui même
+	unsigned char classe[256];
 
-	//on initialise le compteur à 0
-	finalInitial = 0;
+	for (int i = 0; i < 256; i++)
+	{
+		classe[i] = i;
+	}
+	construireAFDViergeClasses(automate, nbEtats, nbEtatsFinaux, 256, classe);
+}
 
-	//on compte le nombre d'états à la fois initiaux et finaux dans auto2
-	for(i = 0; i < automate2->nbEtats; i++){
-		final = 0;
-		initial = 0;
+void construireAFDViergeClasses(AFD* automate, int nbEtats, int nbEtatsFinaux, int nbClasses, unsigned char* classe)
+{
+	//l'automate est construit dans l'arène courante
+	automate->arene = areneCourante;
 
-		for(j = 0; j < automate2->nbEtatsInitiaux; j++)
-		{
-			if(automate2->initial[j] == i)
-			{
-				initial = 1;
-			}
-		}
-		for(j = 0; j < automate2->nbEtatsFinaux; j++)
-		{
-			if(automate2->final[j] == i)
-			{
-				final = 1;
-			}
-		}
-		if(final&&initial)
+	//on initialise nombre d'états et ombre d'états finaux
+	automate->nbEtats = nbEtats;
+	automate->nbEtatsFinaux = nbEtatsFinaux;
+
+	//on recopie les classes de caractères
+	automate->nbClasses = nbClasses;
+	for (int i = 0; i < 256; i++)
+	{
+		automate->classe[i] = classe[i];
+	}
+
+	//on initialise le tableau de transitions à -1 pour tout couple départ+classe et on alloue nbEtats cases pour chaque classe
+	for (int i = 0; i < automate->nbClasses; i++)
+	{
+		automate->transition[i] = allouerArene(automate->arene, sizeof(int)*automate->nbEtats);
+		for (int j = 0; j < automate->nbEtats; j++)
 		{
-			finalInitial++;
+			automate->transition[i][j] = -1;
 		}
 	}
 
-	//le nombre d'états finaux du nouvel est le nombre d'états finaux d'auto2 si il n'y a pas d'état initial et final dans auto2
-	//sinon c'est le nombre d'états finaux de auto1 et auto2 moins le nombre d'états initiaux et finaux d'auto2
-	if(finalInitial > 0)
+	//on alloue une case pour chaque état final
+	automate->final = allouerArene(automate->arene, sizeof(int)*automate->nbEtatsFinaux);
+
+}
+
+void desallouerAFD(AFD* automate)
+{
+	//la mémoire d'un automate construit dans une arène n'est rendue qu'avec l'arène
+	if(automate->arene != NULL)
 	{
-		nbEtatsFinaux = automate1->nbEtatsFinaux + automate2->nbEtatsFinaux - finalInitial;
+		return;
 	}
-	else
+
+	//on libère la deuxièmle dimension du tableau de transitions
+	for (int i = 0; i < automate->nbClasses; i++)
 	{
-		nbEtatsFinaux = automate2->nbEtatsFinaux;
+		libererArene(automate->arene, automate->transition[i]);
 	}
+	//on libère le tableau d'états finaux
+	libererArene(automate->arene, automate->final);
+}
 
-	construireAFNDVierge(concatenation, automate1->nbEtats + automate2->nbEtats - automate2->nbEtatsInitiaux, automate1->nbEtatsInitiaux, nbEtatsFinaux);
-	
+//compare deux transitions par état d'arrivée, utilisé pour regrouper les transitions d'un état vers une même destination
+static int comparerArcsParArrivee(const void* a, const void* b)
+{
+	return ((Arc*)a)->arrivee - ((Arc*)b)->arrivee;
+}
+
+int calculerClassesAFND(AFND* automate, unsigned char* classe)
+{
+	//nombre de classes avant et pendant le raffinement
+	int nbClasses;
+	int nbNouvellesClasses;
+
+	//nouvelle[2*k+m] donne la nouvelle classe d'un caractère de classe k dans (m = 1) ou hors (m = 0) de l'ensemble, -1 si elle n'existe pas encore
+	int nouvelle[512];
+
+	//ensemble des caractères menant d'un état à une même destination, un bit par caractère
+	uint64_t ensemble[4];
 
-	//on ajoute les états initiaux de auto1
-	for(i = 0; i < automate1->nbEtatsInitiaux; i++)
+	//table de hachage des ensembles déjà utilisés pour raffiner, un même ensemble ne sépare rien de plus la seconde fois
+	uint64_t* vus;
+	int capaciteVus;
+	int nbVus;
+
+	//copie des transitions d'un état triées par arrivée
+	Arc* arcs;
+	int capaciteArcs;
+
+	//position dans la table de hachage
+	unsigned long h;
+
+	//booléen indiquant si l'ensemble courant a déjà été rencontré
+	int dejaVu;
+
+	//compteurs de boucle
+	int i,j,k,l;
+
+	capaciteVus = 64;
+	nbVus = 0;
+	vus = allouerZeroArene(areneCourante, capaciteVus*4, sizeof(uint64_t));
+	capaciteArcs = 0;
+	arcs = NULL;
+
+	//au départ tous les caractères sont dans la même classe
+	nbClasses = 1;
+	for (i = 0; i < 256; i++)
 	{
-		concatenation->initial[i] = automate1->initial[i];
+		classe[i] = 0;
 	}
 
-
-	//on ajoute les états finaux de auto2 qui ne sont pas initiaux
-	k = 0;
-	for(i = 0; i < automate2->nbEtatsFinaux; i++)
+	//pour chaque état les caractères qui mènent à une destination donnée sont séparés de ceux qui n'y mènent pas
+	for (i = 0; i < automate->nbEtats; i++)
 	{
-		initial = 0;
-		for (j = 0; j < automate2->nbEtatsInitiaux; j++)
-		{
-			if(automate2->initial[j] == automate2->final[i])
-			{
-				initial = 1;
-			}
-		}
-		if(!initial)
+		if(automate->nbTransitions[i] == 0)
 		{
-			concatenation->final[k] = automate2->final[i] + (automate1->nbEtats - automate2->nbEtatsInitiaux) ;
-			k++;
-			
+			continue;
 		}
-	}
-	//si il existe au moins un état d'auto2 qui est initial et final on ajoute tous les états finaux de auto1 aux états finaux
-	if(finalInitial > 0)
-	{
-		j = 0;
-		for(i = k; i < concatenation->nbEtatsFinaux; i++)
+		if(automate->nbTransitions[i] > capaciteArcs)
 		{
-			concatenation->final[i] = automate1->final[j];
-			j++;
+			capaciteArcs = automate->nbTransitions[i];
+			arcs = reallouerArene(areneCourante, arcs, sizeof(Arc)*capaciteArcs);
 		}
-	}
+		memcpy(arcs, automate->transition[i], sizeof(Arc)*automate->nbTransitions[i]);
+		qsort(arcs, automate->nbTransitions[i], sizeof(Arc), comparerArcsParArrivee);
 
-	//on ajoute toutes les transitions de auto1
-	for(i = 0; i < automate1->nbEtats; i++)
-	{
-		for(j = 0; j < automate1->nbEtats; j++)
+		for (j = 0; j < automate->nbTransitions[i]; j = l)
 		{
-			concatenation->nbTransitions[i][j] = automate1->nbTransitions[i][j];
-			if(concatenation->nbTransitions[i][j] > 0)
-			{
-				concatenation->transition[i][j] = malloc(sizeof(int)*concatenation->nbTransitions[i][j]);
-			}
-			for(k = 0; k < automate1->nbTransitions[i][j]; k++)
+			//on réunit les intervalles de toutes les transitions vers la même destination
+			ensemble[0] = ensemble[1] = ensemble[2] = ensemble[3] = 0;
+			for (l = j; l < automate->nbTransitions[i] && arcs[l].arrivee == arcs[j].arrivee; l++)
 			{
-				concatenation->transition[i][j][k] = automate1->transition[i][j][k];
+				for (k = arcs[l].debut; k <= arcs[l].fin; k++)
+				{
+					ensemble[k/64] |= (uint64_t)1 << (k%64);
+				}
 			}
-		}
-	}
 
-	//pour chaque état 1 de auto2
-	for (i = 0; i < automate2->nbEtats; i++)
-	{
-		initial = 0;
-		for(j = 0; j < automate2->nbEtatsInitiaux; j++){
-			if(i == automate2->initial[i])
+			//l'ensemble vide et l'ensemble complet ne séparent aucun caractère
+			if((ensemble[0]|ensemble[1]|ensemble[2]|ensemble[3]) == 0 || (ensemble[0]&ensemble[1]&ensemble[2]&ensemble[3]) == ~(uint64_t)0)
 			{
-				initial = 1;
+				continue;
 			}
-		}
-		//si i est initial
-		if(initial)
-		{
-			//pour chaque état j de auto 2
-			for(j = 0; j < automate2->nbEtats; j++)
+
+			//on cherche l'ensemble dans la table par sondage linéaire
+			h = (ensemble[0] ^ ensemble[1]*31 ^ ensemble[2]*961 ^ ensemble[3]*29791) * 11400714819323198485UL;
+			h = (h >> 32) & (capaciteVus - 1);
+			dejaVu = 0;
+			while(vus[h*4] | vus[h*4+1] | vus[h*4+2] | vus[h*4+3])
 			{
-				initial = 0;
-				for(k = 0; k < automate2->nbEtatsInitiaux; k++)
-				{
-					if(j == automate2->initial[k])
-					{
-						initial = 1;
-					}
-				}
-				//si j n'est pas initial
-				if(!initial)
+				if(memcmp(&vus[h*4], ensemble, sizeof(ensemble)) == 0)
 				{
-					//pour chaque transition k de i vers j
-					for(k = 0; k < automate2->nbTransitions[i][j]; k++)
-					{
-						//pour chaque l état de auto1
-						for(l = 0; l < automate1->nbEtats; l++)
-						{
-							final = 0;
-							for(m = 0; m < automate1->nbEtatsFinaux; m++)
-							{
-								if(l == automate1->final[m])
-								{
-									final = 1;
-								}
-							}
-							//si l est un état final
-							if(final)
-							{
-								//on ajoute la transition k mais de l vers j en décalant du nombre d'états de auto1 et du nombre d'états initiaux de auto2 qu'on a retirés
-								concatenation->nbTransitions[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)]++;
-								if(concatenation->nbTransitions[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)] == 1)
-								{
-									concatenation->transition[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)] = malloc(sizeof(int)*concatenation->nbTransitions[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)]);
-								}
-								else
-								{
-									concatenation->transition[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)] = realloc(concatenation->transition[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)], sizeof(int)*concatenation->nbTransitions[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)]);
-								}
-								concatenation->transition[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)][concatenation->nbTransitions[l][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)]-1] = automate2->transition[i][j][k];
-							}
-						}
-					}
+					dejaVu = 1;
+					break;
 				}
-				else //si j est initial
+				h = (h + 1) & (capaciteVus - 1);
+			}
+			if(dejaVu)
+			{
+				continue;
+			}
+			memcpy(&vus[h*4], ensemble, sizeof(ensemble));
+			nbVus++;
+
+			//on garde la table à moitié vide en doublant sa taille et en y replaçant les ensembles
+			if(2*nbVus > capaciteVus)
+			{
+				uint64_t* anciens = vus;
+				int ancienneCapacite = capaciteVus;
+				capaciteVus *= 2;
+				vus = allouerZeroArene(areneCourante, capaciteVus*4, sizeof(uint64_t));
+				for (k = 0; k < ancienneCapacite; k++)
 				{
-					//pour chaque transition k de i vers j
-					for(k = 0; k < automate2->nbTransitions[i][j]; k++)
+					if(anciens[k*4] | anciens[k*4+1] | anciens[k*4+2] | anciens[k*4+3])
 					{
-						//pour chaque état l de auto 1
-						for(l = 0; l < automate1->nbEtats; l++)
+						h = (anciens[k*4] ^ anciens[k*4+1]*31 ^ anciens[k*4+2]*961 ^ anciens[k*4+3]*29791) * 11400714819323198485UL;
+						h = (h >> 32) & (capaciteVus - 1);
+						while(vus[h*4] | vus[h*4+1] | vus[h*4+2] | vus[h*4+3])
 						{
-							final = 0;
-							for(m = 0; m < automate1->nbEtatsFinaux; m++)
-							{
-								if(l == automate1->final[m])
-								{
-									final = 1;
-								}
-							}
-							//si l est final
-							if(final)
-							{
-								//pour chaque état n de auto1
-								for(n = 0; n < automate1->nbEtats; m++)
-								{
-									final = 0;
-									for(o = 0; o < automate1->nbEtatsFinaux; o++)
-									{
-										if(n == automate1->final[o])
-										{
-											final = 1;
-										}
-									}
-									//si n est final
-									if(final)
-									{
-										//on ajoute la transition k mais de l vers n sans décalage car l et n proviennent de auto1
-										if(concatenation->nbTransitions[l][n] == 0){
-											concatenation->nbTransitions[l][n]++;
-											concatenation->transition[l][n] = malloc(sizeof(int)*concatenation->nbTransitions[l][n]);
-										}
-										else
-										{
-											concatenation->nbTransitions[l][n]++;
-											concatenation->transition[l][n] = realloc(concatenation->transition[l][n],sizeof(int)*concatenation->nbTransitions[l][n]);
-										}
-										concatenation->transition[l][n][concatenation->nbTransitions[l][n]-1] = automate2->transition[i][j][k];
-									}
-								}
-							}
+							h = (h + 1) & (capaciteVus - 1);
 						}
+						memcpy(&vus[h*4], &anciens[k*4], 4*sizeof(uint64_t));
 					}
 				}
+				libererArene(areneCourante, anciens);
 			}
-		}
-		else //si i n'est pas initial 
-		{
-			//pour chaque état j de auto2
-			for (j = 0; j < automate2->nbEtats; j++)
+
+			for (k = 0; k < 2*nbClasses; k++)
+			{
+				nouvelle[k] = -1;
+			}
+			//on renumérote dans l'ordre des caractères pour garder des classes numérotées par premier caractère
+			nbNouvellesClasses = 0;
+			for (k = 0; k < 256; k++)
 			{
-				//si il existe au moins une transition de i à j dans auto2
-				if(automate2->nbTransitions[i][j] > 0)
+				int dedans = (ensemble[k/64] >> (k%64)) & 1;
+				if(nouvelle[2*classe[k]+dedans] == -1)
 				{
-					//on ajoute toutes les transitions k de i vers j en décalant du nombre d'états d'auto1 et du nombre d'états initiaux d'auto2 qu'on a retirés
-					if(concatenation->nbTransitions[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)] == 0)
-					{
-						concatenation->nbTransitions[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)] += automate2->nbTransitions[i][j];
-						concatenation->transition[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)] = malloc(sizeof(int)*concatenation->nbTransitions[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)]);
-					}
-					else
-					{
-						concatenation->nbTransitions[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)] += automate2->nbTransitions[i][j];
-						concatenation->transition[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)] = realloc(concatenation->transition[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)], sizeof(int)*concatenation->nbTransitions[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)]);
-					}
-					for(k = 0; k < automate2->nbTransitions[i][j]; k++)
-					{
-						concatenation->transition[i + (automate1->nbEtats - automate2->nbEtatsInitiaux)][j + (automate1->nbEtats - automate2->nbEtatsInitiaux)][k] = automate2->transition[i][j][k];
-					}
+					nouvelle[2*classe[k]+dedans] = nbNouvellesClasses;
+					nbNouvellesClasses++;
 				}
-				
+				classe[k] = nouvelle[2*classe[k]+dedans];
 			}
+			nbClasses = nbNouvellesClasses;
 		}
 	}
+
+	libererArene(areneCourante, arcs);
+	libererArene(areneCourante, vus);
+	return nbClasses;
 }
 
-void fermetureIterativeDeKleene(AFND* automate, AFND* fermeIterativement)
+void compresserAFD(AFD* automate)
 {
-	//compteurs de boucle
-	int i,j,k,l,m;
+	//empreinte de chaque colonne conservée pour éviter de comparer les colonnes deux à deux
+	unsigned long empreinte[256];
 
-	//compteur d'états à la fois initiaux et finaux
-	int initialFinal;
+	//empreinte de la colonne examinée
+	unsigned long empreinteCourante;
 
-	//booléens utilisés pour vérifier si un état est initial ou final
-	int initial;
-	int final;
+	//nouvelle classe de chaque ancienne classe
+	int nouvelle[256];
 
-	initialFinal = 0;
+	//nombre de classes après compression
+	int nbClasses;
 
-	//on compte le nombre d'états initiaux et finaux
-	for (i = 0; i < automate->nbEtatsInitiaux; i++)
+	//compteurs de boucle
+	int i,j;
+
+	nbClasses = 0;
+	for (i = 0; i < automate->nbClasses; i++)
 	{
-		for (j = 0; j < automate->nbEtatsFinaux; j++)
+		//empreinte FNV-1a de la colonne
+		empreinteCourante = 14695981039346656037UL;
+		for (j = 0; j < automate->nbEtats; j++)
 		{
-			if(automate->initial[i] == automate->final[j])
-			{
-				initialFinal++;
+			empreinteCourante = (empreinteCourante ^ (unsigned int)automate->transition[i][j]) * 1099511628211UL;
+		}
+
+		//on cherche une colonne déjà conservée identique, les colonnes conservées occupent les nbClasses premières cases
+		nouvelle[i] = -1;
+		for (j = 0; j < nbClasses && nouvelle[i] == -1; j++)
+		{
+			if(empreinte[j] == empreinteCourante && memcmp(automate->transition[j], automate->transition[i], sizeof(int)*automate->nbEtats) == 0)
+			{
+				nouvelle[i] = j;
 			}
 		}
+
+		//si il n'y en a pas la colonne devient une nouvelle classe, sinon elle est libérée
+		if(nouvelle[i] == -1)
+		{
+			nouvelle[i] = nbClasses;
+			empreinte[nbClasses] = empreinteCourante;
+			automate->transition[nbClasses] = automate->transition[i];
+			nbClasses++;
+		}
+		else
+		{
+			libererArene(automate->arene, automate->transition[i]);
+		}
 	}
 
-	//on construit un AFND du même nombre d'états et d'états initiaux, le nombre d'états finaux et le nombre de l'automate initial plus les états initiaux qui ne sont pas finaux dans l'automate initial
-	construireAFNDVierge(fermeIterativement, automate->nbEtats, automate->nbEtatsInitiaux, automate->nbEtatsFinaux + (automate->nbEtatsInitiaux - initialFinal));
-	
-	//k sert de curseur pour le tableau des finaux
-	k = 0;
-	//on ajoute tous les états finaux d'auto
-	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	for (i = 0; i < 256; i++)
 	{
-		fermeIterativement->final[k] = automate->final[i];
-		k++;
+		automate->classe[i] = nouvelle[automate->classe[i]];
 	}
+	automate->nbClasses = nbClasses;
+}
 
-	//on ajoute tous les états initiaux de auto qui ne sont pas finaux dans auto
-	//car ils ont été ajoutés dans le for précédent
-	for (i = 0; i < automate->nbEtatsInitiaux; i++)
+//calcule l'empreinte d'un ensemble trié d'états
+static unsigned long empreinteEnsemble(int* ensemble, int taille)
+{
+	unsigned long h;
+	int i;
+
+	h = 14695981039346656037UL;
+	for (i = 0; i < taille; i++)
 	{
-		fermeIterativement->initial[i] = automate->initial[i];
-		final = 0;
-		for (j = 0; j < automate->nbEtatsFinaux; j++)
-		{
-			if(automate->final[j] == automate->initial[i])
-			{
-				final = 1;
-			}
-		}
-		if(!final)
+		h = (h ^ (unsigned int)ensemble[i]) * 1099511628211UL;
+	}
+	return h;
+}
+
+//initialise une table d'ensembles vide dont les tableaux viennent de l'arène fournie, ou de malloc si elle vaut NULL
+static void initialiserTableEnsembles(TableEnsembles* table, Arene* arene)
+{
+	int i;
+
+	table->arene = arene;
+	table->nbEnsembles = 0;
+	table->capaciteEnsembles = 16;
+	table->debut = allouerArene(table->arene, sizeof(int)*(table->capaciteEnsembles+1));
+	table->debut[0] = 0;
+	table->empreinte = allouerArene(table->arene, sizeof(unsigned long)*table->capaciteEnsembles);
+	table->capaciteElements = 64;
+	table->elements = allouerArene(table->arene, sizeof(int)*table->capaciteElements);
+	table->capaciteIndex = 32;
+	table->index = allouerArene(table->arene, sizeof(int)*table->capaciteIndex);
+	for (i = 0; i < table->capaciteIndex; i++)
+	{
+		table->index[i] = -1;
+	}
+}
+
+//libère la mémoire allouée à une table d'ensembles
+static void libererTableEnsembles(TableEnsembles* table)
+{
+	libererArene(table->arene, table->debut);
+	libererArene(table->arene, table->empreinte);
+	libererArene(table->arene, table->elements);
+	libererArene(table->arene, table->index);
+}
+
+//retourne le numéro de l'ensemble trié donné dans la table, en l'ajoutant à la fin si il n'y est pas encore
+//ajoute est mis à vrai si l'ensemble vient d'être ajouté
+static int chercherOuAjouterEnsemble(TableEnsembles* table, int* ensemble, int taille, int* ajoute)
+{
+	//empreinte de l'ensemble cherché
+	unsigned long h;
+
+	//case de la table de hachage examinée
+	int position;
+
+	//numéro d'un ensemble de la table
+	int numero;
+
+	//compteur de boucle
+	int i;
+
+	h = empreinteEnsemble(ensemble, taille);
+
+	//sondage linéaire, on ne compare les composants que si empreinte et taille coïncident
+	position = (h >> 17) & (table->capaciteIndex - 1);
+	while(table->index[position] != -1)
+	{
+		numero = table->index[position];
+		if(table->empreinte[numero] == h && table->debut[numero+1] - table->debut[numero] == taille && memcmp(&table->elements[table->debut[numero]], ensemble, sizeof(int)*taille) == 0)
 		{
-			fermeIterativement->final[k] = automate->initial[i];
-			k++;
+			*ajoute = 0;
+			return numero;
 		}
+		position = (position + 1) & (table->capaciteIndex - 1);
+	}
+
+	//on agrandit les tableaux en doublant leur taille pour que les ajouts restent en temps constant amorti
+	if(table->nbEnsembles == table->capaciteEnsembles)
+	{
+		table->capaciteEnsembles *= 2;
+		table->debut = reallouerArene(table->arene, table->debut, sizeof(int)*(table->capaciteEnsembles+1));
+		table->empreinte = reallouerArene(table->arene, table->empreinte, sizeof(unsigned long)*table->capaciteEnsembles);
+	}
+	while(table->debut[table->nbEnsembles] + taille > table->capaciteElements)
+	{
+		table->capaciteElements *= 2;
+		table->elements = reallouerArene(table->arene, table->elements, sizeof(int)*table->capaciteElements);
 	}
 
-	//on ajoute toutes les transitions de auto 
-	for(i = 0; i < automate->nbEtats; i++)
+	numero = table->nbEnsembles;
+	memcpy(&table->elements[table->debut[numero]], ensemble, sizeof(int)*taille);
+	table->debut[numero+1] = table->debut[numero] + taille;
+	table->empreinte[numero] = h;
+	table->index[position] = numero;
+	table->nbEnsembles++;
+
+	//on garde la table de hachage au plus à moitié pleine
+	if(2*table->nbEnsembles > table->capaciteIndex)
 	{
-		for(j = 0; j < automate->nbEtats; j++)
+		libererArene(table->arene, table->index);
+		table->capaciteIndex *= 2;
+		table->index = allouerArene(table->arene, sizeof(int)*table->capaciteIndex);
+		for (i = 0; i < table->capaciteIndex; i++)
+		{
+			table->index[i] = -1;
+		}
+		for (i = 0; i < table->nbEnsembles; i++)
 		{
-			if(automate->nbTransitions[i][j] > 0)
+			position = (table->empreinte[i] >> 17) & (table->capaciteIndex - 1);
+			while(table->index[position] != -1)
 			{
-				fermeIterativement->nbTransitions[i][j] = automate->nbTransitions[i][j];
-				fermeIterativement->transition[i][j] = malloc(sizeof(int)*fermeIterativement->nbTransitions[i][j]);
-				for(k = 0; k < automate->nbTransitions[i][j]; k++)
-				{
-					fermeIterativement->transition[i][j][k] = automate->transition[i][j][k];
-				}
+				position = (position + 1) & (table->capaciteIndex - 1);
 			}
+			table->index[position] = i;
 		}
 	}
 
-	//pour chaque état initial initial[i] de auto
-	for(i = 0; i < automate->nbEtatsInitiaux; i++)
+	*ajoute = 1;
+	return numero;
+}
+
+//compare deux entiers, utilisé pour trier les ensembles d'états
+static int comparerEntiers(const void* a, const void* b)
+{
+	return (*(int*)a > *(int*)b) - (*(int*)a < *(int*)b);
+}
+
+//ajoute à ensemble les états atteints spontanément depuis ses états et retourne sa nouvelle taille
+//les états de ensemble doivent être marqués de tampon, ensemble sert lui-même de file : chaque transition spontanée est suivie une fois
+static int fermerEpsilon(AFND* automate, int* ensemble, int taille, int* marque, int tampon)
+{
+	//état d'arrivée examiné
+	int arrivee;
+
+	//compteurs de boucle
+	int i,j;
+
+	for (i = 0; i < taille; i++)
 	{
-		//pour chaque état j de auto
-		for(j = 0; j < automate->nbEtats; j++)
+		for (j = 0; j < automate->nbEpsilons[ensemble[i]]; j++)
 		{
-			//si il y a une transition de initial[i] à j
-			if(automate->nbTransitions[automate->initial[i]][j] > 0)
+			arrivee = automate->epsilon[ensemble[i]][j];
+			if(marque[arrivee] != tampon)
 			{
-				//pour chaque état final final[k] de auto
-				for(k = 0; k < automate->nbEtatsFinaux; k++)
-				{
-					//m = nombre de transition actuel de final[k] à j
-					m = fermeIterativement->nbTransitions[automate->final[k]][j];
-					//on ajoute le nombre de transitions de initial[i] à j dans auto au nombre de transitions de final[k] à j dans fermé
-					fermeIterativement->nbTransitions[automate->final[k]][j] += automate->nbTransitions[automate->initial[i]][j];
-					//si il n'y avait pas de transitions on alloue la mémoire, si il y en avait on la réalloue
-					if(m == 0)
-					{
-						fermeIterativement->transition[automate->final[k]][j] = malloc(sizeof(int)*fermeIterativement->nbTransitions[automate->final[k]][j]);
-					}
-					else
-					{
-						fermeIterativement->transition[automate->final[k]][j] = realloc(fermeIterativement->transition[automate->final[k]][j], sizeof(int)*fermeIterativement->nbTransitions[automate->final[k]][j]);
-					}
-					//pour chaque transition l de initial[i] à j dans auto
-					for (l = 0; l < automate->nbTransitions[automate->initial[i]][j]; l++)
-					{
-						//on ajoute une transition identique au départ de final[k] dans fermé
-						fermeIterativement->transition[automate->final[k]][j][m] = automate->transition[automate->initial[i]][j][l];
-						m++;
-					}
-				}
+				marque[arrivee] = tampon;
+				ensemble[taille] = arrivee;
+				taille++;
 			}
 		}
 	}
+	return taille;
 }
 
-void construireAFDVierge(AFD* automate, int nbEtats, int nbEtatsFinaux)
+//calcule dans ensemble l'ensemble trié des états initiaux et des états qu'ils atteignent spontanément, retourne sa taille
+//marque et tampon sont utilisés comme dans successeurEnsemble
+static int ensembleInitial(AFND* automate, int* ensemble, int* marque, int* tampon)
 {
-	//on initialise nombre d'états et ombre d'états finaux
-	automate->nbEtats = nbEtats;
-	automate->nbEtatsFinaux = nbEtatsFinaux;
+	int taille;
+	int i;
 
-	//on initialise le tableau de transitions à -1 pour tout couple départ+caractère et on alloue nbEtats cases pour chaque caractère
-	for (int i = 0; i < 256; i++)
+	(*tampon)++;
+	taille = 0;
+	for (i = 0; i < automate->nbEtatsInitiaux; i++)
 	{
-		automate->transition[i] = malloc(sizeof(int)*automate->nbEtats);
-		for (int j = 0; j < automate->nbEtats; j++)
+		if(marque[automate->initial[i]] != *tampon)
 		{
-			automate->transition[i][j] = -1;
+			marque[automate->initial[i]] = *tampon;
+			ensemble[taille] = automate->initial[i];
+			taille++;
 		}
 	}
-
-	//on alloue une case pour chaque état final
-	automate->final = malloc(sizeof(int)*automate->nbEtatsFinaux);
-
+	taille = fermerEpsilon(automate, ensemble, taille, marque, *tampon);
+	qsort(ensemble, taille, sizeof(int), comparerEntiers);
+	return taille;
 }
 
-void desallouerAFD(AFD* automate)
+//calcule dans resultat l'ensemble trié des états atteints depuis les états de ensemble par le caractère car, transitions spontanées comprises, et retourne sa taille
+//marque doit contenir une case par état de l'automate, une case valant *tampon signale un état déjà ajouté
+//tampon est incrémenté à chaque appel pour éviter de remettre marque à zéro
+static int successeurEnsemble(AFND* automate, int* ensemble, int taille, int car, int* resultat, int* marque, int* tampon)
 {
-	//on libère la deuxièmle dimension du tableau de transitions
-	for (int i = 0; i < 256; i++)
+	//nombre d'états dans le résultat
+	int nbResultat;
+
+	//transition examinée
+	Arc* arc;
+
+	//compteurs de boucle
+	int i,j;
+
+	(*tampon)++;
+	nbResultat = 0;
+	for (i = 0; i < taille; i++)
 	{
-		free(automate->transition[i]);
+		for (j = 0; j < automate->nbTransitions[ensemble[i]]; j++)
+		{
+			arc = &automate->transition[ensemble[i]][j];
+			if(arc->debut <= car && car <= arc->fin && marque[arc->arrivee] != *tampon)
+			{
+				marque[arc->arrivee] = *tampon;
+				resultat[nbResultat] = arc->arrivee;
+				nbResultat++;
+			}
+		}
 	}
-	//on libère le tableau d'états finaux
-	free(automate->final);
+	nbResultat = fermerEpsilon(automate, resultat, nbResultat, marque, *tampon);
+	qsort(resultat, nbResultat, sizeof(int), comparerEntiers);
+	return nbResultat;
 }
 
-void determiniser(AFND* nonDeter, AFD* deter)
+//déterminise l'automate en laissant dans table les ensembles d'états non déterministes composant chaque état, à libérer par l'appelant
+static void determiniserTable(AFND* nonDeter, AFD* deter, TableEnsembles* table)
 {
 	//compteurs de boucle
-	int i,j,k,l,m,n;
+	int i,j;
 
-	//tableau des transitions pour la version déterministe
-	int* transitionDeter[256];
+	//tableau des transitions pour la version déterministe rangé état par état, la transition de l'état e par la classe k est à l'indice e*nbClasses+k
+	int* transitionDeter;
 
-	//nombre d'états de la version déterministe
-	int nbEtatsDeter;
+	//nombre d'états pour lesquels transitionDeter est alloué
+	int capaciteTransitionDeter;
 
 	//tableaux des états finaux de la version déterministe
 	int* finalDeter;
 
-	//nombre d'états finaux de la version déterministe
+	//nombre d'états finaux de la version déterministe et nombre de cases allouées pour finalDeter
 	int nbEtatsFinauxDeter;
-
-	//état initial de la version déterministe
-	int initialDeter;
+	int capaciteFinalDeter;
 
 	//table contenant les états composant le nouvel état
 	int* tableNouvEtat;
@@ -781,175 +1914,104 @@ void determiniser(AFND* nonDeter, AFD* deter)
 	//nombre d'états composant le nouvel état
 	int compNouvEtat;
 
-	//table des états de la version déterministe
-	int** tableEtat;
+	//numéro de l'état déterministe correspondant au nouvel état
+	int numero;
 
-	//nombre d'états composant un état de la version déterministe
-	int* compEtat;
+	//booléen indiquant si le nouvel état vient d'être ajouté à la table
+	int ajoute;
 
 	//état courant
 	int courant;
 
-	//booléen permettant de vérifier si un élément est déjà dans un ensemble auquel on veut l'ajouter
-	int duplicat;
-
-	//booléen indiquant si un état final a déjà été ajouté à la version déterministe
-	int etatFinalAjoute;
-	
-	//on initialise l'état courant à 0
-	courant = 0;
-
-	//on initialise le nombre d'états de la version déterministe à 1
-	nbEtatsDeter = 1;
+	//estFinal[i] vaut 1 si l'état i de la version non déterministe est final
+	unsigned char* estFinal;
 
-	//on alloue une case pour le tableau nombre de composants
-	compEtat = malloc(sizeof(int));
+	//marques utilisées par successeurEnsemble pour éliminer les doublons sans parcourir le nouvel état
+	int* marque;
+	int tampon;
 
-	//le premier état est l'état initial composé de tous les états initiaux de la version non déterministe
-	compEtat[courant] = nonDeter->nbEtatsInitiaux;
-	tableEtat = malloc(sizeof(int*));
-	tableEtat[courant] = malloc(sizeof(int)*compEtat[courant]);
+	//classe de chaque caractère et nombre de classes de la version non déterministe
+	unsigned char classe[256];
+	int nbClasses;
 
-	//on initialise toutes les transitions vers l'état 0 à -1
-	for (i = 0; i < 256; i++){
-		transitionDeter[i] = malloc(sizeof(int));
-		transitionDeter[i][0] = -1;
+	//premier caractère de chaque classe, il suffit de tester ce caractère pour connaître les transitions de toute la classe
+	int representant[256];
+	
+	//on ne parcourt qu'un caractère par classe au lieu des 256 caractères
+	nbClasses = calculerClassesAFND(nonDeter, classe);
+	for (i = 255; i >= 0; i--)
+	{
+		representant[classe[i]] = i;
 	}
 
-	//on ajoute tous les états initiaux aux composants de l'états courant
-	for (i = 0; i < compEtat[courant]; i++)
+	estFinal = allouerZeroArene(areneCourante, nonDeter->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < nonDeter->nbEtatsFinaux; i++)
 	{
-		tableEtat[courant][i] = nonDeter->initial[i];
+		estFinal[nonDeter->final[i]] = 1;
 	}
 
+	marque = allouerZeroArene(areneCourante, nonDeter->nbEtats, sizeof(int));
+	tampon = 0;
+	tableNouvEtat = allouerArene(areneCourante, sizeof(int)*(nonDeter->nbEtats + nonDeter->nbEtatsInitiaux + 1));
+
+	capaciteTransitionDeter = 16;
+	transitionDeter = allouerArene(areneCourante, sizeof(int)*capaciteTransitionDeter*nbClasses);
+	nbEtatsFinauxDeter = 0;
+	capaciteFinalDeter = 16;
+	finalDeter = allouerArene(areneCourante, sizeof(int)*capaciteFinalDeter);
+
+	initialiserTableEnsembles(table, areneCourante);
+
+	//le premier état est l'état initial composé de tous les états initiaux de la version non déterministe et de ceux qu'ils atteignent spontanément
+	//les ensembles fermés sont mémorisés dans la table : la fermeture d'un ensemble n'est calculée qu'une fois par transition déterministe
+	compNouvEtat = ensembleInitial(nonDeter, tableNouvEtat, marque, &tampon);
+	chercherOuAjouterEnsemble(table, tableNouvEtat, compNouvEtat, &ajoute);
+
 	//tant qu'il reste des états de la version déterministe à traiter
-	while(courant < nbEtatsDeter)
+	for (courant = 0; courant < table->nbEnsembles; courant++)
 	{
-		//pour chaque caractère i
-		for (i = 0; i < 256; i++)
+		//l'état courant vient d'être ajouté à la table : on initialise ses transitions à -1 et on vérifie si il est final
+		if(courant == capaciteTransitionDeter)
 		{
-			//on initialise le nombre de composant d'un potentiel nouvel état à 0
-			compNouvEtat = 0;
-
-			//pour chaque composant j de l'état courant
-			for (j = 0; j < compEtat[courant]; j++)
-			{
-					//pour chaque état l de la version non déterministe
-					for (l = 0; l < nonDeter->nbEtats; l++)
-					{
-						//pour chaque transition m entre le composant j et l'état l
-						for (m = 0; m < nonDeter->nbTransitions[tableEtat[courant][j]][l]; m++)
-						{
-							//si cette transition se fait pour le caractère i
-							if(nonDeter->transition[tableEtat[courant][j]][l][m] == i)
-							{
-								//on initialise le booléen à 0
-								duplicat = 0;
-
-								//pour chaque composant n de notre nouvel état
-								for(n = 0; n < compNouvEtat; n++)
-								{
-									//si l = n on passe le booléen à vrai
-									if(l==tableNouvEtat[n])
-									{
-										duplicat=1;
-									}
-								}
-								//si notre composant n'est pas encore dans le nouvel état on l'y ajoute
-								if(!duplicat)
-								{
-									compNouvEtat++;
-									if(compNouvEtat == 1)
-									{
-										tableNouvEtat = malloc(sizeof(int));
-									}
-									else
-									{
-										tableNouvEtat = realloc(tableNouvEtat, sizeof(int)*compNouvEtat);
-									}
-									tableNouvEtat[compNouvEtat-1] = l;
-								}
-							}
-						}
-					}
-			}
-			//si notre potentiel nouvel état a au moins un composant
-			if(compNouvEtat > 0)
+			capaciteTransitionDeter *= 2;
+			transitionDeter = reallouerArene(areneCourante, transitionDeter, sizeof(int)*capaciteTransitionDeter*nbClasses);
+		}
+		for (i = 0; i < nbClasses; i++)
+		{
+			transitionDeter[courant*nbClasses + i] = -1;
+		}
+		for (i = table->debut[courant]; i < table->debut[courant+1]; i++)
+		{
+			if(estFinal[table->elements[i]])
 			{
-				//on vérifie si notre potentiel nouvel état fait déjà partie des états découverts
-				duplicat = 0;
-				for (j = 0; j < nbEtatsDeter; j++)
-				{
-					if(est_meme_etat(compNouvEtat,compEtat[j],tableNouvEtat,tableEtat[j]))
-					{
-						duplicat = 1;
-						transitionDeter[i][courant] = j;
-					}
-				}
-				//sinon on l'ajoute aux états de la version déterministe à traiter
-				if(duplicat==0)
+				if(nbEtatsFinauxDeter == capaciteFinalDeter)
 				{
-					nbEtatsDeter++;
-					
-					compEtat = realloc(compEtat, sizeof(int)*nbEtatsDeter);
-					tableEtat = realloc(tableEtat, sizeof(int*)*nbEtatsDeter);
-
-					compEtat[nbEtatsDeter-1] = compNouvEtat;
-
-					tableEtat[nbEtatsDeter-1] = malloc(sizeof(int)*compNouvEtat);
-					
-					for (j = 0; j < compNouvEtat; j++)
-					{
-						tableEtat[nbEtatsDeter-1][j] = tableNouvEtat[j];
-					}
-
-					for (j = 0; j < 256; j++)
-					{
-						transitionDeter[j] = realloc(transitionDeter[j], sizeof(int)*nbEtatsDeter);
-						transitionDeter[j][nbEtatsDeter-1] = -1;
-					}
-					transitionDeter[i][courant] = nbEtatsDeter-1;
+					capaciteFinalDeter *= 2;
+					finalDeter = reallouerArene(areneCourante, finalDeter, sizeof(int)*capaciteFinalDeter);
 				}
-				
-			}
-			//si de la mémoire a été allouée au potentiel nouvel état on la libère pour l'itération suivante
-			if(compNouvEtat > 0)
-			{
-				free(tableNouvEtat);
+				finalDeter[nbEtatsFinauxDeter] = courant;
+				nbEtatsFinauxDeter++;
+				break;
 			}
 		}
-		//on incrémente l'état courant
-		courant++;
-		
-	}
-	//pour chaque état de la version déterministe on l'ajoute aux états finaux si un de ces composants est un état final de la version non déterministe
-	nbEtatsFinauxDeter = 0;
-	for (i = 0; i < nbEtatsDeter; i++)
-	{
-		etatFinalAjoute = 0;
-		for (j = 0; j < compEtat[i]; j++)
+
+		//pour chaque classe de caractères i
+		for (i = 0; i < nbClasses; i++)
 		{
-			for (k = 0; k < nonDeter->nbEtatsFinaux; k++)
+			//les composants de l'état courant sont relus à chaque classe car la table peut être réallouée par un ajout
+			compNouvEtat = successeurEnsemble(nonDeter, &table->elements[table->debut[courant]], table->debut[courant+1] - table->debut[courant], representant[i], tableNouvEtat, marque, &tampon);
+
+			//si notre potentiel nouvel état a au moins un composant on le cherche parmi les états découverts, il est ajouté si il est nouveau
+			if(compNouvEtat > 0)
 			{
-				if(tableEtat[i][j] == nonDeter->final[k] && etatFinalAjoute == 0)
-				{
-					nbEtatsFinauxDeter++;
-					if(nbEtatsFinauxDeter == 1)
-					{
-						finalDeter = malloc(sizeof(int));
-					}
-					else
-					{
-						finalDeter = realloc(finalDeter, sizeof(int)*nbEtatsFinauxDeter);
-					}
-					finalDeter[nbEtatsFinauxDeter-1] = i;
-					etatFinalAjoute = 1;
-				}
+				numero = chercherOuAjouterEnsemble(table, tableNouvEtat, compNouvEtat, &ajoute);
+				transitionDeter[courant*nbClasses + i] = numero;
 			}
 		}
 	}
+
 	//on initialise la version déterministe
-	construireAFDVierge(deter, nbEtatsDeter, nbEtatsFinauxDeter);
+	construireAFDViergeClasses(deter, table->nbEnsembles, nbEtatsFinauxDeter, nbClasses, classe);
 	
 	//l'état initial est toujours 0, il est traité manuellement avant la boucle 
 	deter->initial = 0;
@@ -959,26 +2021,31 @@ void determiniser(AFND* nonDeter, AFD* deter)
 	{
 		deter->final[i] = finalDeter[i];
 	}
-	free(finalDeter);
 
 	//on ajoute les transitions découvertes à la version déterministe
-	for (i = 0; i < 256; i++)
+	for (i = 0; i < nbClasses; i++)
 	{
 		for (j = 0; j < deter->nbEtats; j++)
 		{
-			deter->transition[i][j] = transitionDeter[i][j];
+			deter->transition[i][j] = transitionDeter[j*nbClasses + i];
 		}
-		//on libère le tableau de transition par la même occasion
-		free(transitionDeter[i]);
 	}
 
-	//on libère le reste des tableaux intermédiaires
-	for(i = 0; i < nbEtatsDeter; i++)
-	{
-		free(tableEtat[i]);
-	}
-	free(tableEtat);
-	free(compEtat);
+	//on libère les tableaux intermédiaires
+	libererArene(areneCourante, transitionDeter);
+	libererArene(areneCourante, finalDeter);
+	libererArene(areneCourante, tableNouvEtat);
+	libererArene(areneCourante, estFinal);
+	libererArene(areneCourante, marque);
+}
+
+void determiniser(AFND* nonDeter, AFD* deter)
+{
+	//table des états de la version déterministe, seul l'automate est gardé
+	TableEnsembles table;
+
+	determiniserTable(nonDeter, deter, &table);
+	libererTableEnsembles(&table);
 }
 
 int est_meme_etat(int compEtat1, int compEtat2, int* tableEtat1, int* tableEtat2)
@@ -1023,361 +2090,5383 @@ int est_meme_etat(int compEtat1, int compEtat2, int* tableEtat1, int* tableEtat2
 	return identique;
 }
 
-int est_reconnu(char* mot, int longueurMot, AFD* automate)
+//range dans drapeaux, pour chaque état de l'automate, ETAT_ACCEPTEUR si il est final, ETAT_MORT si aucun état final n'est
+//accessible depuis lui et ETAT_UNIVERSEL si tous les mots lus depuis lui sont reconnus
+static void analyserEtatsAFD(AFD* automate, unsigned char* drapeaux)
 {
-	//état courant pendant l'exécution
-	int etatCourant;
+	//prédécesseurs de chaque état toutes classes confondues, ceux de q sont predecesseur[debut[q]] à predecesseur[debut[q+1]-1]
+	int* debut;
+	int* predecesseur;
 
-	//compteur de boucle
-	int i;
+	//file des états dont le drapeau vient de changer
+	int* file;
+	int nbFile;
 
-	//booléen valeur de retour
-	int reconnu;
+	//destination de la transition courante
+	int dest;
 
-	//on initialise la valeur de retour à faux
-	reconnu = 0;
+	//compteurs de boucle
+	int i,j,k;
 
-	//l'état courant est initilement l'état intial
-	etatCourant = automate->initial;
+	//transitions inverses construites par comptage, comme dans minimiserHopcroft
+	debut = allouerZeroArene(areneCourante, automate->nbEtats + 2, sizeof(int));
+	predecesseur = allouerArene(areneCourante, sizeof(int)*((size_t)automate->nbClasses*automate->nbEtats + 1));
+	file = allouerArene(areneCourante, sizeof(int)*(automate->nbEtats + 1));
+	for (k = 0; k < automate->nbClasses; k++)
+	{
+		for (i = 0; i < automate->nbEtats; i++)
+		{
+			dest = automate->transition[k][i];
+			if(dest != -1)
+			{
+				debut[dest + 1]++;
+			}
+		}
+	}
+	for (i = 1; i <= automate->nbEtats; i++)
+	{
+		debut[i] += debut[i-1];
+	}
+	for (k = 0; k < automate->nbClasses; k++)
+	{
+		for (i = 0; i < automate->nbEtats; i++)
+		{
+			dest = automate->transition[k][i];
+			if(dest != -1)
+			{
+				predecesseur[debut[dest]] = i;
+				debut[dest]++;
+			}
+		}
+	}
+	for (i = automate->nbEtats; i > 0; i--)
+	{
+		debut[i] = debut[i-1];
+	}
+	debut[0] = 0;
 
-	//pour chaque caractère composant le mot
-	for (i = 0; i < longueurMot; i++)
+	//un état est vivant si il est final ou si un de ses successeurs l'est : parcours en arrière depuis les états finaux
+	for (i = 0; i < automate->nbEtats; i++)
 	{
-		printf("lecture de %c\n",mot[i] );
-		//si il existe une transition depuis l'état courant par ce caractère 
-		if(automate->transition[mot[i]][etatCourant] != -1)
+		drapeaux[i] = ETAT_MORT;
+	}
+	nbFile = 0;
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		if(drapeaux[automate->final[i]] & ETAT_MORT)
+		{
+			file[nbFile] = automate->final[i];
+			nbFile++;
+		}
+		drapeaux[automate->final[i]] = ETAT_ACCEPTEUR;
+	}
+	for (j = 0; j < nbFile; j++)
+	{
+		for (i = debut[file[j]]; i < debut[file[j]+1]; i++)
 		{
-			//l'état courant devient la destination de cette transition
-			etatCourant = automate->transition[mot[i]][etatCourant];
-			printf("transition vers : %d\n", etatCourant);
+			if(drapeaux[predecesseur[i]] & ETAT_MORT)
+			{
+				drapeaux[predecesseur[i]] &= ~ETAT_MORT;
+				file[nbFile] = predecesseur[i];
+				nbFile++;
+			}
 		}
 	}
 
-	//si l'état courant à la fin de l'exécutuion fait partie des états finaux on passe la valeur de retour à vrai
-	for(i = 0; i < automate->nbEtatsFinaux; i++)
+	//un état final est universel tant qu'il n'a ni transition absente ni transition vers un état qui ne l'est pas :
+	//on part des états qui ne le sont pas et on retire en arrière leurs prédécesseurs
+	nbFile = 0;
+	for (i = 0; i < automate->nbEtats; i++)
 	{
-		if(automate->final[i] == etatCourant)
+		if(drapeaux[i] & ETAT_ACCEPTEUR)
 		{
-			reconnu = 1;
-			printf("%d est accepteur\n",etatCourant );
+			drapeaux[i] |= ETAT_UNIVERSEL;
+			for (k = 0; k < automate->nbClasses && (drapeaux[i] & ETAT_UNIVERSEL); k++)
+			{
+				if(automate->transition[k][i] == -1)
+				{
+					drapeaux[i] &= ~ETAT_UNIVERSEL;
+				}
+			}
+		}
+		if(!(drapeaux[i] & ETAT_UNIVERSEL))
+		{
+			file[nbFile] = i;
+			nbFile++;
 		}
 	}
-	//on retourne notre valeur de retour
-	return reconnu;
+	for (j = 0; j < nbFile; j++)
+	{
+		for (i = debut[file[j]]; i < debut[file[j]+1]; i++)
+		{
+			if(drapeaux[predecesseur[i]] & ETAT_UNIVERSEL)
+			{
+				drapeaux[predecesseur[i]] &= ~ETAT_UNIVERSEL;
+				file[nbFile] = predecesseur[i];
+				nbFile++;
+			}
+		}
+	}
+
+	libererArene(areneCourante, file);
+	libererArene(areneCourante, predecesseur);
+	libererArene(areneCourante, debut);
 }
 
-void minimiser(AFD* automate, AFD* minimal)
+//construit dans elague l'automate privé de ses états morts, les transitions qui y menaient devenant absentes,
+//et range dans nouveau le numéro dans elague de chaque état, -1 pour un état retiré ; l'état initial est toujours gardé
+//retourne faux sans rien construire si il n'y a aucun état à retirer
+static int elaguerAFD(AFD* automate, AFD* elague, int* nouveau)
 {
-	//compteurs de boucles
-	int i,j,k,l,m;
-
-	//indique si le compteur courant correspond à un état final
-	int final;
-
-	// deux tableaux de classes class1[i] contient la classe ou l'ensemble d'états dans lequel se trouve i
-	// la boucle s'arrête quand le tableau de classes précédent est identique au tableau courant
-	// on en utilise donc deux qu'on rempli à tour de rôle pour préserer l'itération précédente
-	int* classe1;
-	int* classe2;
-
-	//nombre de classes existantes dans chaque tableau, pas utile pour les accès mémoire mais permet de remplir les tableau
-	//permet également de valoriser le nombre d'états du nouvel automate car une classe = un nouvel état
-	int nbClasses1;
-	int nbClasses2;
+	//drapeaux de chaque état
+	unsigned char* drapeaux;
 
-	//contient pour chaque couple [caractère][état] la classe de l'état vers lequel on transitionne pour le couple donné
-	//permet de raffiner les classes à la fin de chaque itération, deux états ne restent dans la même classe que si ils transitionnent vers la même classe pour tout l'alphabet
-	int* transitionClasse[256];
+	//nombre d'états gardés
+	int nbGardes;
 
-	//variable temporaire pour stocker l'état destination d'une transition
+	//destination de la transition courante
 	int dest;
 
-	//variable d'arrêt pour la boucle de minimisation
-	int arret;
+	//compteurs de boucle
+	int i,k;
 
-	//variable contenant 1 ou 2 en fonction du tableau de classes à remplir à l'itération suivante
-	int nextClasse;
+	drapeaux = allouerArene(areneCourante, automate->nbEtats + 1);
+	analyserEtatsAFD(automate, drapeaux);
+	nbGardes = 0;
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		if(!(drapeaux[i] & ETAT_MORT) || i == automate->initial)
+		{
+			nouveau[i] = nbGardes;
+			nbGardes++;
+		}
+		else
+		{
+			nouveau[i] = -1;
+		}
+	}
+	if(nbGardes == automate->nbEtats)
+	{
+		libererArene(areneCourante, drapeaux);
+		return 0;
+	}
+
+	//les états gardés restent dans le même ordre et les états finaux, tous vivants, sont tous gardés
+	construireAFDViergeClasses(elague, nbGardes, automate->nbEtatsFinaux, automate->nbClasses, automate->classe);
+	elague->initial = nouveau[automate->initial];
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		elague->final[i] = nouveau[automate->final[i]];
+	}
+	for (k = 0; k < automate->nbClasses; k++)
+	{
+		for (i = 0; i < automate->nbEtats; i++)
+		{
+			dest = automate->transition[k][i];
+			if(nouveau[i] != -1 && dest != -1 && !(drapeaux[dest] & ETAT_MORT))
+			{
+				elague->transition[k][nouveau[i]] = nouveau[dest];
+			}
+		}
+	}
+	libererArene(areneCourante, drapeaux);
+	return 1;
+}
+
+//lit les caractères fournis depuis l'état fourni et retourne l'état atteint
+//retourne -1 dès qu'il n'existe pas de transition, sans lire la suite, ainsi que si l'état fourni vaut déjà -1
+//utilisé par toutes les fonctions de reconnaissance silencieuses
+static int avancerAFD(AFD* automate, int etatCourant, char* mot, size_t longueurMot)
+{
+	//compteur de boucle
+	size_t i;
+
+	for (i = 0; i < longueurMot && etatCourant != -1; i++)
+	{
+		//le caractère est lu comme non signé pour que les caractères au delà de 127 indexent bien le tableau
+		etatCourant = automate->transition[automate->classe[(unsigned char)mot[i]]][etatCourant];
+	}
+	return etatCourant;
+}
+
+//retourne vrai si l'état fourni est un état final de l'automate, faux pour -1
+static int estFinalAFD(AFD* automate, int etat)
+{
+	//compteur de boucle
+	int i;
+
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		if(automate->final[i] == etat)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+//parcourt l'automate depuis son état initial sur les caractères du mot et retourne l'état atteint, -1 si le mot est rejeté en route
+static int parcourirAFD(char* mot, int longueurMot, AFD* automate)
+{
+	return avancerAFD(automate, automate->initial, mot, longueurMot);
+}
+
+int est_reconnu(char* mot, int longueurMot, AFD* automate)
+{
+	//état atteint à la fin du mot
+	int etatCourant;
+
+	//compteur de boucle
+	int i;
+
+	etatCourant = parcourirAFD(mot, longueurMot, automate);
+
+	//le mot est reconnu si l'état atteint fait partie des états finaux, -1 n'en fait jamais partie
+	for(i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		if(automate->final[i] == etatCourant)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int est_reconnu_trace(char* mot, int longueurMot, AFD* automate)
+{
+	//état courant pendant l'exécution
+	int etatCourant;
+
+	//compteur de boucle
+	int i;
+
+	//booléen valeur de retour
+	int reconnu;
+
+	//on initialise la valeur de retour à faux
+	reconnu = 0;
+
+	//l'état courant est initilement l'état intial
+	etatCourant = automate->initial;
+
+	//pour chaque caractère composant le mot
+	for (i = 0; i < longueurMot; i++)
+	{
+		printf("lecture de %c\n",mot[i] );
+		//si il n'existe pas de transition depuis l'état courant par ce caractère le mot est rejeté sans lire la suite
+		if(automate->transition[automate->classe[(unsigned char)mot[i]]][etatCourant] == -1)
+		{
+			printf("pas de transition, mot rejeté\n");
+			return 0;
+		}
+		//l'état courant devient la destination de cette transition
+		etatCourant = automate->transition[automate->classe[(unsigned char)mot[i]]][etatCourant];
+		printf("transition vers : %d\n", etatCourant);
+	}
+
+	//si l'état courant à la fin de l'exécutuion fait partie des états finaux on passe la valeur de retour à vrai
+	for(i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		if(automate->final[i] == etatCourant)
+		{
+			reconnu = 1;
+			printf("%d est accepteur\n",etatCourant );
+		}
+	}
+	//on retourne notre valeur de retour
+	return reconnu;
+}
+
+//teste un lot de mots connaissant le tableau des états finaux de l'automate (accepteur[i] vaut 1 si l'état i est final)
+static void reconnaitreLotAccepteur(Mot* mots, int nbMots, AFD* automate, unsigned char* accepteur, unsigned char* resultats)
+{
+	//état atteint à la fin du mot courant
+	int etat;
+
+	//compteur de boucle
+	int i;
+
+	//on remet à zéro les octets de résultats avant d'y poser les bits des mots reconnus
+	for (i = 0; i < (nbMots+7)/8; i++)
+	{
+		resultats[i] = 0;
+	}
+
+	for (i = 0; i < nbMots; i++)
+	{
+		etat = parcourirAFD(mots[i].caracteres, mots[i].longueur, automate);
+		if(etat != -1 && accepteur[etat])
+		{
+			resultats[i/8] |= 1 << (i%8);
+		}
+	}
+}
+
+void reconnaitreLot(Mot* mots, int nbMots, AFD* automate, unsigned char* resultats)
+{
+	//accepteur[i] vaut 1 si l'état i est final, calculé une seule fois pour tout le lot
+	unsigned char* accepteur;
+
+	//compteur de boucle
+	int i;
+
+	accepteur = calloc(automate->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		accepteur[automate->final[i]] = 1;
+	}
+
+	reconnaitreLotAccepteur(mots, nbMots, automate, accepteur, resultats);
+
+	free(accepteur);
+}
+
+int reconnaitreTampon(char* tampon, int taille, AFD* automate, unsigned char* resultats)
+{
+	//accepteur[i] vaut 1 si l'état i est final
+	unsigned char* accepteur;
+
+	//début du mot courant dans le tampon
+	int debut;
+
+	//nombre de mots déjà testés
+	int nbMots;
+
+	//état atteint à la fin du mot courant
+	int etat;
+
+	//compteur de boucle
+	int i;
+
+	accepteur = calloc(automate->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		accepteur[automate->final[i]] = 1;
+	}
+
+	nbMots = 0;
+	debut = 0;
+	//le dernier tour de boucle (i == taille) termine le mot courant si le tampon ne finit pas par '\n'
+	for (i = 0; i <= taille; i++)
+	{
+		if(i == taille && debut == taille)
+		{
+			break;
+		}
+		if(i == taille || tampon[i] == '\n')
+		{
+			//on pose le bit du mot ou on le remet à zéro, le tampon de résultats n'a pas besoin d'être initialisé
+			etat = parcourirAFD(tampon + debut, i - debut, automate);
+			if(etat != -1 && accepteur[etat])
+			{
+				resultats[nbMots/8] |= 1 << (nbMots%8);
+			}
+			else
+			{
+				resultats[nbMots/8] &= ~(1 << (nbMots%8));
+			}
+			nbMots++;
+			debut = i + 1;
+		}
+	}
+
+	free(accepteur);
+	return nbMots;
+}
+
+int resultatLot(unsigned char* resultats, int i)
+{
+	return (resultats[i/8] >> (i%8)) & 1;
+}
+
+//retourne la destination de l'état fourni par la classe fournie dans la table d'un automate compact
+static size_t lireTransitionCompact(AFDCompact* compact, size_t etat, int classe)
+{
+	if(compact->largeur == 1)
+	{
+		return ((uint8_t*)compact->transition)[etat*compact->nbClasses + classe];
+	}
+	else if(compact->largeur == 2)
+	{
+		return ((uint16_t*)compact->transition)[etat*compact->nbClasses + classe];
+	}
+	return ((uint32_t*)compact->transition)[etat*compact->nbClasses + classe];
+}
+
+//repère les états d'un automate compact que peu d'octets font quitter, comme ceux des .*, et ceux où la lecture peut s'arrêter
+static void accelererAFDCompact(AFDCompact* compact)
+{
+	//nombre d'octets faisant quitter l'état courant
+	int nbSortants;
+
+	//compteurs de boucle
+	int e,c;
+
+	compact->acceleration = calloc(compact->nbEtats, sizeof(unsigned char));
+	compact->octetsSortants = malloc((size_t)compact->nbEtats*ACCELERATION_OCTETS_MAX);
+	compact->nbEtatsAcceleres = 0;
+	for (e = 0; e < compact->nbEtats; e++)
+	{
+		//un état qu'aucun octet ne fait quitter est toujours mort ou universel
+		if(compact->drapeaux[e] & (ETAT_MORT | ETAT_UNIVERSEL))
+		{
+			compact->acceleration[e] = ACCELERATION_ARRET;
+			compact->nbEtatsAcceleres++;
+			continue;
+		}
+		nbSortants = 0;
+		for (c = 0; c < 256 && nbSortants <= ACCELERATION_OCTETS_MAX; c++)
+		{
+			if(lireTransitionCompact(compact, e, compact->classe[c]) != (size_t)e)
+			{
+				if(nbSortants < ACCELERATION_OCTETS_MAX)
+				{
+					compact->octetsSortants[e*ACCELERATION_OCTETS_MAX + nbSortants] = c;
+				}
+				nbSortants++;
+			}
+		}
+		if(nbSortants <= ACCELERATION_OCTETS_MAX)
+		{
+			//les cases restantes répètent le premier octet pour que la recherche compare toujours quatre octets
+			for (c = nbSortants; c < ACCELERATION_OCTETS_MAX; c++)
+			{
+				compact->octetsSortants[e*ACCELERATION_OCTETS_MAX + c] = compact->octetsSortants[e*ACCELERATION_OCTETS_MAX];
+			}
+			compact->acceleration[e] = nbSortants;
+			compact->nbEtatsAcceleres++;
+		}
+	}
+}
+
+#if defined(__SSE2__)
+//cherche par comparaisons AVX2 de 32 octets à la fois la première position de [debut, fin[ égale à un des quatre octets fournis
+//retourne cette position, ou la position à partir de laquelle il reste moins de 32 octets à examiner si aucun ne l'est avant
+//compilée pour l'AVX2 quelles que soient les options du programme, elle n'est appelée que si le processeur le permet
+__attribute__((target("avx2")))
+static int chercherOctetsSortantsAVX2(unsigned char* mot, int debut, int fin, unsigned char* octets)
+{
+	//octets cherchés répétés dans chaque case d'un registre et octets lus
+	__m256i o0 = _mm256_set1_epi8(octets[0]), o1 = _mm256_set1_epi8(octets[1]), o2 = _mm256_set1_epi8(octets[2]), o3 = _mm256_set1_epi8(octets[3]);
+	__m256i lus;
+
+	//masque des positions égales à un des octets cherchés
+	unsigned int masque;
+
+	//position courante
+	int i;
+
+	for (i = debut; i + 32 <= fin; i += 32)
+	{
+		lus = _mm256_loadu_si256((__m256i*)(mot + i));
+		masque = _mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(lus, o0), _mm256_cmpeq_epi8(lus, o1)), _mm256_or_si256(_mm256_cmpeq_epi8(lus, o2), _mm256_cmpeq_epi8(lus, o3))));
+		if(masque != 0)
+		{
+			return i + __builtin_ctz(masque);
+		}
+	}
+	return i;
+}
+#endif
+
+//retourne la première position à partir de debut où le mot contient un des nbOctets octets fournis, ou fin si il n'y en a pas
+//un seul octet est cherché par memchr, jusqu'à quatre par comparaisons SSE2 de 16 octets à la fois, ou AVX2 de 32 octets quand le processeur le permet
+static int chercherOctetsSortants(unsigned char* mot, int debut, int fin, unsigned char* octets, int nbOctets)
+{
+	//position trouvée par memchr
+	unsigned char* trouve;
+
+	//position courante
+	int i;
+
+	if(nbOctets == 1)
+	{
+		trouve = memchr(mot + debut, octets[0], fin - debut);
+		return trouve == NULL ? fin : trouve - mot;
+	}
+
+	i = debut;
+#if defined(__SSE2__)
+	//l'AVX2 est choisi à l'exécution, le programme restant compilé pour le seul SSE2
+	if(__builtin_cpu_supports("avx2"))
+	{
+		//une position trouvée est retrouvée par le premier bloc SSE2, sinon celui-ci lit les moins de 32 octets restants
+		i = chercherOctetsSortantsAVX2(mot, i, fin, octets);
+	}
+	{
+		//octets cherchés répétés dans chaque case d'un registre et octets lus
+		__m128i o0 = _mm_set1_epi8(octets[0]), o1 = _mm_set1_epi8(octets[1]), o2 = _mm_set1_epi8(octets[2]), o3 = _mm_set1_epi8(octets[3]);
+		__m128i lus;
+
+		//masque des positions égales à un des octets cherchés
+		unsigned int masque;
+
+		for (; i + 16 <= fin; i += 16)
+		{
+			lus = _mm_loadu_si128((__m128i*)(mot + i));
+			masque = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(lus, o0), _mm_cmpeq_epi8(lus, o1)), _mm_or_si128(_mm_cmpeq_epi8(lus, o2), _mm_cmpeq_epi8(lus, o3))));
+			if(masque != 0)
+			{
+				return i + __builtin_ctz(masque);
+			}
+		}
+	}
+#endif
+	for (; i < fin; i++)
+	{
+		if(mot[i] == octets[0] || mot[i] == octets[1] || mot[i] == octets[2] || mot[i] == octets[3])
+		{
+			return i;
+		}
+	}
+	return fin;
+}
+
+void compilerAFD(AFD* automate, AFDCompact* compact)
+{
+	//destination de la transition courante
+	int dest;
+
+	//numéro de l'état mort qui reçoit les transitions absentes, -1 si l'automate n'en a pas
+	int mort;
+
+	//compteurs de boucle
+	int i,j;
+
+	//un seul état mort est ajouté pour toutes les transitions absentes
+	mort = -1;
+	for (j = 0; j < automate->nbClasses && mort == -1; j++)
+	{
+		for (i = 0; i < automate->nbEtats && mort == -1; i++)
+		{
+			if(automate->transition[j][i] == -1)
+			{
+				mort = automate->nbEtats;
+			}
+		}
+	}
+
+	compact->nbEtats = mort == -1 ? automate->nbEtats : automate->nbEtats + 1;
+	compact->initial = automate->initial;
+	compact->projection = NULL;
+	compact->tailleProjection = 0;
+
+	//on reprend les classes de caractères de l'automate, une ligne de la table contient une case par classe
+	compact->nbClasses = automate->nbClasses;
+	for (i = 0; i < 256; i++)
+	{
+		compact->classe[i] = automate->classe[i];
+	}
+
+	//on choisit la plus petite largeur capable de représenter tous les numéros d'états
+	if(compact->nbEtats <= 256)
+	{
+		compact->largeur = 1;
+	}
+	else if(compact->nbEtats <= 65536)
+	{
+		compact->largeur = 2;
+	}
+	else
+	{
+		compact->largeur = 4;
+	}
+
+	compact->transition = malloc((size_t)compact->largeur*compact->nbClasses*compact->nbEtats);
+
+	//on recopie les transitions colonne par colonne dans l'ordre état par état, l'état mort boucle sur lui-même
+	for (i = 0; i < compact->nbEtats; i++)
+	{
+		for (j = 0; j < compact->nbClasses; j++)
+		{
+			dest = i == mort ? mort : automate->transition[j][i];
+			if(dest == -1)
+			{
+				dest = mort;
+			}
+			if(compact->largeur == 1)
+			{
+				((uint8_t*)compact->transition)[(size_t)i*compact->nbClasses+j] = dest;
+			}
+			else if(compact->largeur == 2)
+			{
+				((uint16_t*)compact->transition)[(size_t)i*compact->nbClasses+j] = dest;
+			}
+			else
+			{
+				((uint32_t*)compact->transition)[(size_t)i*compact->nbClasses+j] = dest;
+			}
+		}
+	}
+
+	//un octet de drapeaux par état au lieu de la liste des états finaux
+	compact->drapeaux = malloc(compact->nbEtats + 1);
+	analyserEtatsAFD(automate, compact->drapeaux);
+	if(mort != -1)
+	{
+		compact->drapeaux[mort] = ETAT_MORT;
+	}
+
+	accelererAFDCompact(compact);
+}
+
+void desallouerAFDCompact(AFDCompact* compact)
+{
+	free(compact->acceleration);
+	free(compact->octetsSortants);
+	if(compact->projection != NULL)
+	{
+		munmap(compact->projection, compact->tailleProjection);
+		return;
+	}
+	free(compact->transition);
+	free(compact->drapeaux);
+}
+
+//identique à est_reconnu_compact pour un automate ayant des états accélérés : un état accéléré est traversé d'un bond
+//jusqu'au prochain octet qui le fait quitter, et la lecture s'arrête dès qu'un état absorbant est atteint
+static int reconnaitreCompactAccelere(char* mot, int longueurMot, AFDCompact* compact)
+{
+	//état courant pendant l'exécution
+	size_t etatCourant;
+
+	//nombre de classes, classe de chaque caractère et accélération de chaque état, copiés localement pour rester en registre
+	size_t nbClasses;
+	unsigned char* classe;
+	unsigned char* acceleration;
+
+	//position courante
+	int i;
+
+	etatCourant = compact->initial;
+	nbClasses = compact->nbClasses;
+	classe = compact->classe;
+	acceleration = compact->acceleration;
+
+	//une boucle par largeur, comme dans est_reconnu_compact
+	i = 0;
+	if(compact->largeur == 1)
+	{
+		uint8_t* table = compact->transition;
+		while(i < longueurMot)
+		{
+			if(acceleration[etatCourant] != 0)
+			{
+				if(acceleration[etatCourant] == ACCELERATION_ARRET)
+				{
+					break;
+				}
+				i = chercherOctetsSortants((unsigned char*)mot, i, longueurMot, &compact->octetsSortants[etatCourant*ACCELERATION_OCTETS_MAX], acceleration[etatCourant]);
+				if(i == longueurMot)
+				{
+					break;
+				}
+			}
+			etatCourant = table[etatCourant*nbClasses + classe[(unsigned char)mot[i]]];
+			i++;
+		}
+	}
+	else if(compact->largeur == 2)
+	{
+		uint16_t* table = compact->transition;
+		while(i < longueurMot)
+		{
+			if(acceleration[etatCourant] != 0)
+			{
+				if(acceleration[etatCourant] == ACCELERATION_ARRET)
+				{
+					break;
+				}
+				i = chercherOctetsSortants((unsigned char*)mot, i, longueurMot, &compact->octetsSortants[etatCourant*ACCELERATION_OCTETS_MAX], acceleration[etatCourant]);
+				if(i == longueurMot)
+				{
+					break;
+				}
+			}
+			etatCourant = table[etatCourant*nbClasses + classe[(unsigned char)mot[i]]];
+			i++;
+		}
+	}
+	else
+	{
+		uint32_t* table = compact->transition;
+		while(i < longueurMot)
+		{
+			if(acceleration[etatCourant] != 0)
+			{
+				if(acceleration[etatCourant] == ACCELERATION_ARRET)
+				{
+					break;
+				}
+				i = chercherOctetsSortants((unsigned char*)mot, i, longueurMot, &compact->octetsSortants[etatCourant*ACCELERATION_OCTETS_MAX], acceleration[etatCourant]);
+				if(i == longueurMot)
+				{
+					break;
+				}
+			}
+			etatCourant = table[etatCourant*nbClasses + classe[(unsigned char)mot[i]]];
+			i++;
+		}
+	}
+
+	return compact->drapeaux[etatCourant] & ETAT_ACCEPTEUR;
+}
+
+int est_reconnu_compact(char* mot, int longueurMot, AFDCompact* compact)
+{
+	//état courant pendant l'exécution
+	size_t etatCourant;
+
+	//nombre de classes et classe de chaque caractère, copiés localement pour rester en registre
+	size_t nbClasses;
+	unsigned char* classe;
+
+	//compteur de boucle
+	int i;
+
+	etatCourant = compact->initial;
+	nbClasses = compact->nbClasses;
+	classe = compact->classe;
+
+	if(compact->nbEtatsAcceleres > 0)
+	{
+		return reconnaitreCompactAccelere(mot, longueurMot, compact);
+	}
+
+	//une boucle par largeur pour que le test de largeur ne soit pas fait à chaque caractère
+	if(compact->largeur == 1)
+	{
+		uint8_t* table = compact->transition;
+		for (i = 0; i < longueurMot; i++)
+		{
+			etatCourant = table[etatCourant*nbClasses + classe[(unsigned char)mot[i]]];
+		}
+	}
+	else if(compact->largeur == 2)
+	{
+		uint16_t* table = compact->transition;
+		for (i = 0; i < longueurMot; i++)
+		{
+			etatCourant = table[etatCourant*nbClasses + classe[(unsigned char)mot[i]]];
+		}
+	}
+	else
+	{
+		uint32_t* table = compact->transition;
+		for (i = 0; i < longueurMot; i++)
+		{
+			etatCourant = table[etatCourant*nbClasses + classe[(unsigned char)mot[i]]];
+		}
+	}
+
+	return compact->drapeaux[etatCourant] & ETAT_ACCEPTEUR;
+}
+
+void minimiser(AFD* automate, AFD* minimal)
+{
+	//compteurs de boucles
+	int i,j,k,l,m;
+
+	//indique si le compteur courant correspond à un état final
+	int final;
+
+	// deux tableaux de classes class1[i] contient la classe ou l'ensemble d'états dans lequel se trouve i
+	// la boucle s'arrête quand le tableau de classes précédent est identique au tableau courant
+	// on en utilise donc deux qu'on rempli à tour de rôle pour préserer l'itération précédente
+	int* classe1;
+	int* classe2;
+
+	//nombre de classes existantes dans chaque tableau, pas utile pour les accès mémoire mais permet de remplir les tableau
+	//permet également de valoriser le nombre d'états du nouvel automate car une classe = un nouvel état
+	int nbClasses1;
+	int nbClasses2;
+
+	//contient pour chaque couple [classe de caractères][état] la classe de l'état vers lequel on transitionne pour le couple donné
+	//permet de raffiner les classes à la fin de chaque itération, deux états ne restent dans la même classe que si ils transitionnent vers la même classe pour tout l'alphabet
+	int* transitionClasse[256];
+
+	//variable temporaire pour stocker l'état destination d'une transition
+	int dest;
+
+	//variable d'arrêt pour la boucle de minimisation
+	int arret;
+
+	//variable contenant 1 ou 2 en fonction du tableau de classes à remplir à l'itération suivante
+	int nextClasse;
 
 	//booléen indiquant si deux états ou classes, ou tableaux de classes sont identiques
 	int identique;
 
-	//booléen indiquant si un état final a déjà été ajouté à la version minimale
-	int dejaAjoute;
+	//booléen indiquant si un état final a déjà été ajouté à la version minimale
+	int dejaAjoute;
+
+	//automate privé de ses états morts et numéro de chaque état dans celui-ci
+	AFD elague;
+	int* numeroElague;
+
+	//une transition absente rejette déjà le mot : les états morts sont retirés avant de minimiser
+	//pour que l'automate minimal n'ait jamais d'état puits
+	numeroElague = allouerArene(areneCourante, sizeof(int)*(automate->nbEtats + 1));
+	if(elaguerAFD(automate, &elague, numeroElague))
+	{
+		libererArene(areneCourante, numeroElague);
+		minimiser(&elague, minimal);
+		desallouerAFD(&elague);
+		return;
+	}
+	libererArene(areneCourante, numeroElague);
+
+	//on commence par remplir le tableau de classes 1 donc le suivant doit être le 2
+	nextClasse = 2;
+
+	//on initialise la variable d'arrêt à 0 pour la boucle de minimisation
+	arret = 0;
+
+	//on alloue une case par état de notre automate pour chaque caractère dans le tableau des transitions
+	for (i = 0; i < automate->nbClasses; i++)
+	{
+		transitionClasse[i] = allouerArene(areneCourante, sizeof(int)*automate->nbEtats);
+	}
+	
+	//pour chaque tableau de classes on alloue une case par état également (puisqu'on veut stocker une classe par état)
+	classe1 = allouerArene(areneCourante, sizeof(int)*automate->nbEtats);
+	classe2 = allouerArene(areneCourante, sizeof(int)*automate->nbEtats);
+
+	//si il n'y a pas d'état final ou si ils le sont tous on a une seule classe et tous les états vont dedans
+	//autrement on a deux classes : une pour les états finaux et une pour les autres
+	if(automate->nbEtatsFinaux == 0 || automate->nbEtatsFinaux == automate->nbEtats)
+	{
+		nbClasses1 = 1;
+		for (i = 0; i < automate->nbEtats; i++)
+		{
+			classe1[i] = 0;
+		}
+	}
+	else
+	{
+		nbClasses1 = 2;
+		for (i = 0; i < automate->nbEtats; i++)
+		{
+			final = 0;
+			for (j = 0; j < automate->nbEtatsFinaux; j++)
+			{
+				if (i == automate->final[j])
+				{
+					final = 1;
+				}
+			}
+			if (final == 1)
+			{
+				classe1[i] = 0;
+			}
+			else
+			{
+				classe1[i] = 1;
+			}
+		}
+	}
+	//les classes 2 sont initialisées plus tard
+	nbClasses2 = 0;
+
+	//tant que la condition d'arrêt n'est pas atteinte
+	while(arret == 0)
+	{
+		//si le prochain tableau à remplir est le 1
+		if(nextClasse == 1)
+		{
+			//pour chaque classe de caractères i
+			for (i = 0; i < automate->nbClasses; i++)
+			{
+				//pour chaque état j
+				for (j = 0; j < automate->nbEtats; j++)
+				{
+					//si il n'y a pas de transition par i à partir de j
+					if(automate->transition[i][j] == -1)
+					{
+						//j ne transitionne vers aucune classe par i
+						transitionClasse[i][j] = -1;
+					}
+					else //si il y a une transition par i à partir de j
+					{
+						//on crée une transition vers la classe de la destination dans transitionClasse
+						transitionClasse[i][j] = classe2[automate->transition[i][j]];
+					}
+				}
+			}
+			//on initialise le nombre de classes à 0 car on rempli le tableau depuis rien
+			nbClasses1 = 0;
+			//pour chaque état i
+			for (i = 0; i < automate->nbEtats; i++)
+			{
+				//on initialise l'état de i au nombre d'états du tableau
+				//le plus bas possible étant 0
+				classe1[i] = nbClasses1;
+				//pour chaque état j traité avant i
+				for (j = 0; j < i; j++)
+				{
+					//deux états ne peuvent rester ensemble que si ils étaient dans la même classe à l'itération précédente
+					identique = classe2[i] == classe2[j];
+					//pour chaque classe de caractères k
+					for (k = 0; k < automate->nbClasses && identique; k++)
+					{
+						//si on ne transitionne pas vers la même classe depuis les états i et j pour le caractère k
+						if(transitionClasse[k][i] != transitionClasse[k][j])
+						{
+							//le booléen identique devient faux pour indiquer que les deux états ne sont pas équivalents au regard de leurs transitions
+							//ils ne peuvent donc pas appartenir à la même classe
+							identique = 0;
+						}
+					}
+					//si les états i et j sont identiques au regard de leurs transitions
+					if(identique == 1)
+					{
+						//on donne la classe de j à i
+						classe1[i] = classe1[j];
+					}
+				}
+				//si i a toujours la classe égale au nombre de classes qu'on lui a donné au début de l'itération
+				//celà implique qu'on n'a trouvé aucun j équivalent à i du point de vue de ses transitions
+				if(classe1[i] == nbClasses1){
+					//on incrémente juste le nombre de classes ce qui revient à créer une nouvelle classe pour i
+					nbClasses1++;
+				}
+			}
+			nextClasse = 2;
+		}
+		else // si le prochain tableau à remplir est le 1 on fait le même traitement en inversant les tableaux
+		{
+			//pour chaque classe de caractères i
+			for (i = 0; i < automate->nbClasses; i++)
+			{
+				//pour chaque état j
+				for (j = 0; j < automate->nbEtats; j++)
+				{
+					//si il n'y a pas de transition depuis j par i
+					if(automate->transition[i][j] == -1)
+					{
+						//j ne transtionne vers aucune classe par i
+						transitionClasse[i][j] = -1;
+					}
+					else //si il y a une transtion depuis j par i
+					{
+						//j transitionne vers la classe de la destination de la transition depuis j par i
+						transitionClasse[i][j] = classe1[automate->transition[i][j]];
+					}
+				}
+			}
+			//on initialise le nombre de classes à 0 car on remplie le tableau depuis rien
+			nbClasses2 = 0;
+			//pour chaque état i
+			for (i = 0; i < automate->nbEtats; i++)
+			{
+				//on assigne le nombre de classes comme classe à l'état
+				//minimum 0
+				classe2[i] = nbClasses2;
+				//pour chaque état j traité avant i
+				for (j = 0; j < i; j++)
+				{
+					//deux états ne peuvent rester ensemble que si ils étaient dans la même classe à l'itération précédente
+					identique = classe1[i] == classe1[j];
+					//pour chaque classe de caractères k
+					for (k = 0; k < automate->nbClasses && identique; k++)
+					{
+						//si i et j ne transitionnent pas vers la même classe pour k
+						if(transitionClasse[k][i] != transitionClasse[k][j])
+						{
+							//le booléen passe à faux car i et j ne sont pas identiques au regard de leurs transitions
+							identique = 0;
+						}
+					}
+					//si i et j sont identiques au regard de leurs transition
+					if(identique == 1)
+					{
+						//on donne à i la classe de j
+						classe2[i] = classe2[j];
+					}
+				}
+				//si i a toujours la classe égale au nombre de classes qu'on lui a donné au début de l'itération
+				//celà implique qu'on n'a trouvé aucun j équivalent à i du point de vue de ses transitions
+				if(classe2[i] == nbClasses2){
+					//on incrémente juste le nombre de classes ce qui revient à créer une nouvelle classe pour i
+					nbClasses2++;
+				}
+			}
+			//le prochain tableau à traiter est le 1
+			nextClasse = 1;
+		}
+		//ici on vérifie si la condition d'arrêt est remplie
+		if(nbClasses1 != nbClasses2)
+		{
+			arret = 0;
+		}
+		else
+		{
+			identique = 1;
+			for (i = 0; i < automate->nbEtats; i++)
+			{
+				if(classe1[i] != classe2[i])
+				{
+					identique = 0;
+				}
+			}
+			if (identique == 1)
+			{
+				arret = 1;
+			}
+		}
+	}
+
+	//selon le dernier tableau de classes rempli on initialise et on complète l'automate minimal avec l'un ou l'autre de nos tableaux
+	if(nextClasse == 2)
+	{
+		construireAFDViergeClasses(minimal,nbClasses1,0,automate->nbClasses,automate->classe);
+		minimal->initial = classe1[automate->initial];
+		for(i = 0; i < automate->nbEtats; i++)
+		{
+			for(j = 0; j < automate->nbEtatsFinaux; j++)
+			{
+				if(automate->final[j] == i)
+				{
+					dejaAjoute = 0;
+					for(k = 0; k < minimal->nbEtatsFinaux; k++)
+					{
+						if(minimal->final[k] == classe1[i])
+						{
+							dejaAjoute = 1;
+						}
+					}
+					if(!dejaAjoute)
+					{
+						minimal->nbEtatsFinaux++;
+						minimal->final = reallouerArene(minimal->arene, minimal->final, sizeof(int)*minimal->nbEtatsFinaux);
+						minimal->final[minimal->nbEtatsFinaux-1] = classe1[i];
+					}
+				}
+			}
+			for(j = 0; j < automate->nbClasses; j++)
+			{
+				minimal->transition[j][classe1[i]] = transitionClasse[j][i];
+			}
+		}
+	}
+	else
+	{
+		construireAFDViergeClasses(minimal,nbClasses2,0,automate->nbClasses,automate->classe);
+		minimal->initial = classe2[automate->initial];
+		k = 0;
+		for(i = 0; i < automate->nbEtats; i++)
+		{
+			for(j = 0; j < automate->nbEtatsFinaux; j++)
+			{
+				if(automate->final[j] == i)
+				{
+					dejaAjoute = 0;
+					for(k = 0; k < minimal->nbEtatsFinaux; k++)
+					{
+						if(minimal->final[k] == classe2[i])
+						{
+							dejaAjoute = 1;
+						}
+					}
+					if(!dejaAjoute)
+					{
+						minimal->nbEtatsFinaux++;
+						minimal->final = reallouerArene(minimal->arene, minimal->final, sizeof(int)*minimal->nbEtatsFinaux);
+						minimal->final[minimal->nbEtatsFinaux-1] = classe2[i];
+					}
+				}
+			}
+			for(j = 0; j < automate->nbClasses; j++)
+			{
+				minimal->transition[j][classe2[i]] = transitionClasse[j][i];
+			}
+		}
+	}
+
+	//on libère les tableaux de transitions et de classes 
+	for (i = 0; i < automate->nbClasses; i++)
+	{
+		libererArene(areneCourante, transitionClasse[i]);
+	}
+	libererArene(areneCourante, classe1);
+	libererArene(areneCourante, classe2);
+
+}
+
+//minimise l'automate par l'algorithme de Hopcroft en partant de la partition des états selon leur étiquette, entre 0 et nbEtiquettes-1
+//deux états d'étiquettes différentes ne sont jamais confondus, etatMinimal reçoit l'état minimal de chaque état si il n'est pas NULL,
+//-1 pour un état mort
+static void minimiserHopcroftEtiquettes(AFD* automate, int* etiquette, int nbEtiquettes, AFD* minimal, int* etatMinimal)
+{
+	//nombre d'états traités, les états de l'automate plus un état puits représentant les transitions absentes
+	int nbEtats;
+
+	//numéro de l'état puits
+	int puits;
+
+	//nombre de classes de caractères
+	int nbClasses;
+
+	//transitions inverses rangées par classe puis par état d'arrivée :
+	//les prédécesseurs de q par la classe a sont inverse[debutInverse[a*(nbEtats+1)+q]] à inverse[debutInverse[a*(nbEtats+1)+q+1]-1]
+	int* debutInverse;
+	int* inverse;
+
+	//partition des états : les états du bloc b occupent les cases debutBloc[b] à finBloc[b]-1 de elements
+	int* elements;
+	int* position;
+	int* bloc;
+	int* debutBloc;
+	int* finBloc;
+	int nbBlocs;
+
+	//nombre d'états marqués au début de chaque bloc lors du traitement d'un séparateur
+	int* marques;
+
+	//blocs ayant au moins un état marqué lors du traitement d'un séparateur
+	int* touches;
+	int nbTouches;
+
+	//pile des séparateurs (bloc, classe) restant à traiter, codés bloc*nbClasses+classe
+	int* attente;
+	int nbAttente;
+	int capaciteAttente;
+
+	//prédécesseurs du séparateur courant
+	int* predecesseurs;
+	int nbPredecesseurs;
+
+	//estFinal[i] vaut 1 si l'état i est final
+	unsigned char* estFinal;
+
+	//numéro dans l'automate minimal de chaque bloc, -1 tant qu'il n'est pas attribué
+	int* numero;
+
+	//nombre d'états de l'automate minimal
+	int nbMinimal;
+
+	//séparateur courant et bloc en cours de découpe
+	int separateur;
+	int classeSeparateur;
+	int b;
+	int nouveau;
+
+	//variables temporaires
+	int dest;
+	int p;
+	int q;
+	int taille;
+
+	//automate privé de ses états morts, numéro de chaque état dans celui-ci, étiquettes et états minimaux de ses états
+	AFD elague;
+	int* numeroElague;
+	int* etiquetteElague;
+	int* etatMinimalElague;
+
+	//compteurs de boucle
+	int i,j,k;
+
+	//les états morts sont retirés d'abord, comme dans minimiser, et l'on minimise l'automate restant
+	numeroElague = allouerArene(areneCourante, sizeof(int)*(automate->nbEtats + 1));
+	if(elaguerAFD(automate, &elague, numeroElague))
+	{
+		etiquetteElague = allouerArene(areneCourante, sizeof(int)*(elague.nbEtats + 1));
+		etatMinimalElague = allouerArene(areneCourante, sizeof(int)*(elague.nbEtats + 1));
+		for (i = 0; i < automate->nbEtats; i++)
+		{
+			if(numeroElague[i] != -1)
+			{
+				etiquetteElague[numeroElague[i]] = etiquette[i];
+			}
+		}
+		minimiserHopcroftEtiquettes(&elague, etiquetteElague, nbEtiquettes, minimal, etatMinimalElague);
+		if(etatMinimal != NULL)
+		{
+			for (i = 0; i < automate->nbEtats; i++)
+			{
+				etatMinimal[i] = numeroElague[i] == -1 ? -1 : etatMinimalElague[numeroElague[i]];
+			}
+		}
+		libererArene(areneCourante, etatMinimalElague);
+		libererArene(areneCourante, etiquetteElague);
+		libererArene(areneCourante, numeroElague);
+		desallouerAFD(&elague);
+		return;
+	}
+	libererArene(areneCourante, numeroElague);
+
+	nbClasses = automate->nbClasses;
+	puits = automate->nbEtats;
+	nbEtats = automate->nbEtats + 1;
+
+	estFinal = allouerZeroArene(areneCourante, nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		estFinal[automate->final[i]] = 1;
+	}
+
+	//construction des transitions inverses par comptage, l'état puits boucle sur lui-même
+	debutInverse = allouerZeroArene(areneCourante, (size_t)nbClasses*(nbEtats+1), sizeof(int));
+	inverse = allouerArene(areneCourante, sizeof(int)*(size_t)nbClasses*nbEtats);
+	for (k = 0; k < nbClasses; k++)
+	{
+		for (i = 0; i < nbEtats; i++)
+		{
+			dest = i == puits ? puits : automate->transition[k][i];
+			if(dest == -1)
+			{
+				dest = puits;
+			}
+			debutInverse[k*(nbEtats+1) + dest + 1]++;
+		}
+	}
+	for (i = 1; i < nbClasses*(nbEtats+1); i++)
+	{
+		debutInverse[i] += debutInverse[i-1];
+	}
+	//debutInverse sert de curseur d'écriture pour chaque liste
+	for (k = 0; k < nbClasses; k++)
+	{
+		for (i = 0; i < nbEtats; i++)
+		{
+			dest = i == puits ? puits : automate->transition[k][i];
+			if(dest == -1)
+			{
+				dest = puits;
+			}
+			inverse[debutInverse[k*(nbEtats+1) + dest]] = i;
+			debutInverse[k*(nbEtats+1) + dest]++;
+		}
+	}
+	//le remplissage a décalé chaque début sur la fin de sa liste, on les remet en place
+	for (i = nbClasses*(nbEtats+1) - 1; i > 0; i--)
+	{
+		debutInverse[i] = debutInverse[i-1];
+	}
+	debutInverse[0] = 0;
+
+	//partition initiale : un bloc par étiquette présente, rempli par comptage, puis l'état puits seul
+	//le puits forme son propre bloc pour qu'une transition absente ne soit jamais confondue avec une transition vers un état réel, comme dans minimiser
+	elements = allouerArene(areneCourante, sizeof(int)*nbEtats);
+	position = allouerArene(areneCourante, sizeof(int)*nbEtats);
+	bloc = allouerArene(areneCourante, sizeof(int)*nbEtats);
+	debutBloc = allouerArene(areneCourante, sizeof(int)*nbEtats);
+	finBloc = allouerArene(areneCourante, sizeof(int)*nbEtats);
+	marques = allouerZeroArene(areneCourante, nbEtats, sizeof(int));
+	touches = allouerArene(areneCourante, sizeof(int)*nbEtats);
+	predecesseurs = allouerArene(areneCourante, sizeof(int)*nbEtats);
+
+	//numero sert d'abord à compter les états de chaque étiquette puis de curseur d'écriture
+	numero = allouerZeroArene(areneCourante, nbEtiquettes + 1, sizeof(int));
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		numero[etiquette[i] + 1]++;
+	}
+	nbBlocs = 0;
+	for (k = 0; k < nbEtiquettes; k++)
+	{
+		if(numero[k + 1] > 0)
+		{
+			debutBloc[nbBlocs] = numero[k];
+			finBloc[nbBlocs] = numero[k] + numero[k + 1];
+			nbBlocs++;
+		}
+		numero[k + 1] += numero[k];
+	}
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		j = numero[etiquette[i]];
+		elements[j] = i;
+		position[i] = j;
+		numero[etiquette[i]]++;
+	}
+	for (b = 0; b < nbBlocs; b++)
+	{
+		for (j = debutBloc[b]; j < finBloc[b]; j++)
+		{
+			bloc[elements[j]] = b;
+		}
+	}
+	libererArene(areneCourante, numero);
+	j = automate->nbEtats;
+	elements[j] = puits;
+	position[puits] = j;
+	bloc[puits] = nbBlocs;
+	debutBloc[nbBlocs] = j;
+	finBloc[nbBlocs] = j + 1;
+	nbBlocs++;
+
+	//tous les blocs initiaux servent de séparateurs pour toutes les classes
+	capaciteAttente = 2*nbBlocs*nbClasses + 16;
+	attente = allouerArene(areneCourante, sizeof(int)*capaciteAttente);
+	nbAttente = 0;
+	for (b = 0; b < nbBlocs; b++)
+	{
+		for (k = 0; k < nbClasses; k++)
+		{
+			attente[nbAttente] = b*nbClasses + k;
+			nbAttente++;
+		}
+	}
+
+	//tant qu'il reste des séparateurs à traiter
+	while(nbAttente > 0)
+	{
+		nbAttente--;
+		separateur = attente[nbAttente] / nbClasses;
+		classeSeparateur = attente[nbAttente] % nbClasses;
+
+		//on relève d'abord les prédécesseurs car le bloc séparateur peut lui-même être découpé
+		nbPredecesseurs = 0;
+		for (i = debutBloc[separateur]; i < finBloc[separateur]; i++)
+		{
+			q = elements[i];
+			for (j = debutInverse[classeSeparateur*(nbEtats+1) + q]; j < debutInverse[classeSeparateur*(nbEtats+1) + q + 1]; j++)
+			{
+				predecesseurs[nbPredecesseurs] = inverse[j];
+				nbPredecesseurs++;
+			}
+		}
+
+		//chaque prédécesseur est déplacé dans la partie marquée au début de son bloc
+		nbTouches = 0;
+		for (i = 0; i < nbPredecesseurs; i++)
+		{
+			p = predecesseurs[i];
+			b = bloc[p];
+			if(marques[b] == 0)
+			{
+				touches[nbTouches] = b;
+				nbTouches++;
+			}
+			j = debutBloc[b] + marques[b];
+			q = elements[j];
+			elements[j] = p;
+			elements[position[p]] = q;
+			position[q] = position[p];
+			position[p] = j;
+			marques[b]++;
+		}
+
+		//chaque bloc partiellement marqué est coupé en deux, la plus petite partie devient un nouveau bloc
+		for (i = 0; i < nbTouches; i++)
+		{
+			b = touches[i];
+			taille = finBloc[b] - debutBloc[b];
+			if(marques[b] == taille)
+			{
+				marques[b] = 0;
+				continue;
+			}
+
+			nouveau = nbBlocs;
+			nbBlocs++;
+			if(marques[b] <= taille - marques[b])
+			{
+				debutBloc[nouveau] = debutBloc[b];
+				finBloc[nouveau] = debutBloc[b] + marques[b];
+				debutBloc[b] = finBloc[nouveau];
+			}
+			else
+			{
+				debutBloc[nouveau] = debutBloc[b] + marques[b];
+				finBloc[nouveau] = finBloc[b];
+				finBloc[b] = debutBloc[nouveau];
+			}
+			marques[b] = 0;
+			for (j = debutBloc[nouveau]; j < finBloc[nouveau]; j++)
+			{
+				bloc[elements[j]] = nouveau;
+			}
+
+			//la plus petite partie suffit comme séparateur : si le bloc d'origine attendait déjà, il attend toujours pour sa partie restante
+			for (k = 0; k < nbClasses; k++)
+			{
+				if(nbAttente == capaciteAttente)
+				{
+					capaciteAttente *= 2;
+					attente = reallouerArene(areneCourante, attente, sizeof(int)*capaciteAttente);
+				}
+				attente[nbAttente] = nouveau*nbClasses + k;
+				nbAttente++;
+			}
+		}
+	}
+
+	//les blocs sont numérotés dans l'ordre de leur plus petit état, comme les classes de minimiser
+	numero = allouerArene(areneCourante, sizeof(int)*nbBlocs);
+	for (b = 0; b < nbBlocs; b++)
+	{
+		numero[b] = -1;
+	}
+	nbMinimal = 0;
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		if(numero[bloc[i]] == -1)
+		{
+			numero[bloc[i]] = nbMinimal;
+			nbMinimal++;
+		}
+	}
+
+	construireAFDViergeClasses(minimal, nbMinimal, 0, nbClasses, automate->classe);
+	minimal->initial = numero[bloc[automate->initial]];
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		//tous les états d'un bloc mènent aux mêmes blocs, on peut donc écrire la même case plusieurs fois
+		for (k = 0; k < nbClasses; k++)
+		{
+			dest = automate->transition[k][i];
+			if(dest == -1)
+			{
+				minimal->transition[k][numero[bloc[i]]] = -1;
+			}
+			else
+			{
+				minimal->transition[k][numero[bloc[i]]] = numero[bloc[dest]];
+			}
+		}
+	}
+
+	//les états finaux sont ajoutés dans l'ordre de leur plus petit état, comme dans minimiser
+	//marques n'est plus utilisé et sert à retenir les blocs déjà ajoutés
+	minimal->final = reallouerArene(minimal->arene, minimal->final, sizeof(int)*nbMinimal);
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		if(estFinal[i] && marques[bloc[i]] == 0)
+		{
+			marques[bloc[i]] = 1;
+			minimal->final[minimal->nbEtatsFinaux] = numero[bloc[i]];
+			minimal->nbEtatsFinaux++;
+		}
+	}
+	if(etatMinimal != NULL)
+	{
+		for (i = 0; i < automate->nbEtats; i++)
+		{
+			etatMinimal[i] = numero[bloc[i]];
+		}
+	}
+	libererArene(areneCourante, numero);
+
+	libererArene(areneCourante, estFinal);
+	libererArene(areneCourante, debutInverse);
+	libererArene(areneCourante, inverse);
+	libererArene(areneCourante, elements);
+	libererArene(areneCourante, position);
+	libererArene(areneCourante, bloc);
+	libererArene(areneCourante, debutBloc);
+	libererArene(areneCourante, finBloc);
+	libererArene(areneCourante, marques);
+	libererArene(areneCourante, touches);
+	libererArene(areneCourante, predecesseurs);
+	libererArene(areneCourante, attente);
+}
+
+void minimiserHopcroft(AFD* automate, AFD* minimal)
+{
+	//étiquette de chaque état : 1 pour un état final, 0 sinon
+	int* etiquette;
+
+	//compteur de boucle
+	int i;
+
+	etiquette = allouerZeroArene(areneCourante, automate->nbEtats + 1, sizeof(int));
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		etiquette[automate->final[i]] = 1;
+	}
+	minimiserHopcroftEtiquettes(automate, etiquette, 2, minimal, NULL);
+	libererArene(areneCourante, etiquette);
+}
+
+//retourne la mémoire occupée par le cache d'un automate paresseux
+static size_t memoireAFDParesseux(AFDParesseux* paresseux)
+{
+	return (size_t)paresseux->table.capaciteEnsembles*(sizeof(int) + sizeof(unsigned long))
+		+ (size_t)paresseux->table.capaciteElements*sizeof(int)
+		+ (size_t)paresseux->table.capaciteIndex*sizeof(int)
+		+ (size_t)paresseux->capacite*(paresseux->nbClasses*sizeof(int) + 1);
+}
+
+//ajoute un ensemble trié au cache d'un automate paresseux et retourne son numéro d'état
+static int ajouterEtatParesseux(AFDParesseux* paresseux, int* ensemble, int taille)
+{
+	//numéro de l'état dans le cache
+	int numero;
+
+	//booléen indiquant si l'ensemble vient d'être ajouté
+	int ajoute;
+
+	//compteur de boucle
+	int i;
+
+	numero = chercherOuAjouterEnsemble(&paresseux->table, ensemble, taille, &ajoute);
+	if(ajoute)
+	{
+		if(numero == paresseux->capacite)
+		{
+			paresseux->capacite *= 2;
+			paresseux->transition = realloc(paresseux->transition, sizeof(int)*paresseux->capacite*paresseux->nbClasses);
+			paresseux->accepteur = realloc(paresseux->accepteur, paresseux->capacite);
+		}
+		for (i = 0; i < paresseux->nbClasses; i++)
+		{
+			paresseux->transition[numero*paresseux->nbClasses + i] = -2;
+		}
+		paresseux->accepteur[numero] = 0;
+		for (i = 0; i < taille; i++)
+		{
+			if(paresseux->estFinal[ensemble[i]])
+			{
+				paresseux->accepteur[numero] = 1;
+			}
+		}
+	}
+	return numero;
+}
+
+//vide le cache d'un automate paresseux en rendant sa mémoire, seul l'ensemble donné y est replacé et reçoit le numéro 0
+static void viderAFDParesseux(AFDParesseux* paresseux, int* ensemble, int taille)
+{
+	libererTableEnsembles(&paresseux->table);
+	initialiserTableEnsembles(&paresseux->table, NULL);
+	paresseux->capacite = 16;
+	paresseux->transition = realloc(paresseux->transition, sizeof(int)*paresseux->capacite*paresseux->nbClasses);
+	paresseux->accepteur = realloc(paresseux->accepteur, paresseux->capacite);
+	ajouterEtatParesseux(paresseux, ensemble, taille);
+	paresseux->nbVidages++;
+}
+
+void construireAFDParesseux(AFND* automate, size_t memoireMax, AFDParesseux* paresseux)
+{
+	int taille;
+	int i;
+
+	paresseux->automate = automate;
+	paresseux->memoireMax = memoireMax;
+	paresseux->nbVidages = 0;
+
+	paresseux->nbClasses = calculerClassesAFND(automate, paresseux->classe);
+	for (i = 255; i >= 0; i--)
+	{
+		paresseux->representant[paresseux->classe[i]] = i;
+	}
+
+	paresseux->estFinal = calloc(automate->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		paresseux->estFinal[automate->final[i]] = 1;
+	}
+
+	//les tampons peuvent contenir tous les états, ou tous les états initiaux avant élimination des doublons
+	paresseux->ensemble = malloc(sizeof(int)*(automate->nbEtats + automate->nbEtatsInitiaux + 1));
+	paresseux->suivant = malloc(sizeof(int)*(automate->nbEtats + 1));
+	paresseux->marque = calloc(automate->nbEtats, sizeof(int));
+	paresseux->tampon = 0;
+
+	//l'état initial est toujours l'état 0 du cache
+	//comme les autres tableaux du cache, la table vient toujours de malloc : elle survit à l'arène courante et ses vidages rendent la mémoire
+	initialiserTableEnsembles(&paresseux->table, NULL);
+	paresseux->capacite = 16;
+	paresseux->transition = malloc(sizeof(int)*paresseux->capacite*paresseux->nbClasses);
+	paresseux->accepteur = malloc(paresseux->capacite);
+	taille = ensembleInitial(automate, paresseux->ensemble, paresseux->marque, &paresseux->tampon);
+	ajouterEtatParesseux(paresseux, paresseux->ensemble, taille);
+}
+
+void desallouerAFDParesseux(AFDParesseux* paresseux)
+{
+	libererTableEnsembles(&paresseux->table);
+	free(paresseux->transition);
+	free(paresseux->accepteur);
+	free(paresseux->estFinal);
+	free(paresseux->ensemble);
+	free(paresseux->suivant);
+	free(paresseux->marque);
+}
+
+int est_reconnu_paresseux(char* mot, int longueurMot, AFDParesseux* paresseux)
+{
+	//état déterministe courant dans le cache
+	int etatCourant;
+
+	//destination de la transition courante
+	int dest;
+
+	//classe du caractère lu
+	int k;
+
+	//taille de l'ensemble courant
+	int taille;
+
+	//position du dernier vidage du cache dans le mot et nombre d'états créés depuis
+	int dernierVidage;
+	int nbCrees;
+
+	//tampon d'échange pour la simulation non déterministe
+	int* echange;
+
+	//compteurs de boucle
+	int i,j;
+
+	//si un vidage précédent a laissé le cache sans l'état initial on l'y replace
+	taille = ensembleInitial(paresseux->automate, paresseux->ensemble, paresseux->marque, &paresseux->tampon);
+	if(paresseux->table.nbEnsembles == 0 || paresseux->table.debut[1] != taille || memcmp(paresseux->table.elements, paresseux->ensemble, sizeof(int)*taille) != 0)
+	{
+		viderAFDParesseux(paresseux, paresseux->ensemble, taille);
+	}
+
+	etatCourant = 0;
+	dernierVidage = 0;
+	nbCrees = 0;
+	for (i = 0; i < longueurMot; i++)
+	{
+		k = paresseux->classe[(unsigned char)mot[i]];
+		dest = paresseux->transition[etatCourant*paresseux->nbClasses + k];
+
+		//transition pas encore calculée : on calcule l'ensemble successeur et on le cherche dans le cache
+		if(dest == -2)
+		{
+			taille = successeurEnsemble(paresseux->automate, &paresseux->table.elements[paresseux->table.debut[etatCourant]], paresseux->table.debut[etatCourant+1] - paresseux->table.debut[etatCourant], paresseux->representant[k], paresseux->suivant, paresseux->marque, &paresseux->tampon);
+			if(taille == 0)
+			{
+				dest = -1;
+			}
+			else
+			{
+				dest = ajouterEtatParesseux(paresseux, paresseux->suivant, taille);
+				nbCrees++;
+			}
+			paresseux->transition[etatCourant*paresseux->nbClasses + k] = dest;
+
+			//cache plein : on le vide en ne gardant que l'état atteint
+			if(dest >= 0 && memoireAFDParesseux(paresseux) > paresseux->memoireMax)
+			{
+				//si moins de 10 caractères ont été lus par état créé depuis le dernier vidage, le cache ne sert à rien :
+				//on termine le mot en simulant l'automate non déterministe
+				if(i - dernierVidage < 10*nbCrees)
+				{
+					memcpy(paresseux->ensemble, paresseux->suivant, sizeof(int)*taille);
+					for (i = i + 1; i < longueurMot && taille > 0; i++)
+					{
+						taille = successeurEnsemble(paresseux->automate, paresseux->ensemble, taille, paresseux->representant[paresseux->classe[(unsigned char)mot[i]]], paresseux->suivant, paresseux->marque, &paresseux->tampon);
+						echange = paresseux->ensemble;
+						paresseux->ensemble = paresseux->suivant;
+						paresseux->suivant = echange;
+					}
+					for (j = 0; j < taille; j++)
+					{
+						if(paresseux->estFinal[paresseux->ensemble[j]])
+						{
+							return 1;
+						}
+					}
+					return 0;
+				}
+				viderAFDParesseux(paresseux, paresseux->suivant, taille);
+				dest = 0;
+				dernierVidage = i;
+				nbCrees = 0;
+			}
+		}
+
+		//ensemble vide : plus aucun état ne peut être atteint, le mot est rejeté
+		if(dest == -1)
+		{
+			return 0;
+		}
+		etatCourant = dest;
+	}
+
+	return paresseux->accepteur[etatCourant];
+}
+
+int construireAFNDBits(AFND* automate, AFNDBits* bits)
+{
+	//premier caractère de chaque classe
+	int representant[256];
+
+	//transition examinée
+	Arc* arc;
+
+	//vecteur des successeurs d'un état
+	uint64_t* masque;
+
+	//fermeture[i*nbMots..] est le vecteur des états atteints spontanément depuis l'état i, i compris
+	uint64_t* fermeture;
+
+	//pile des états à parcourir pendant le calcul d'une fermeture
+	int* pile;
+	int taillePile;
+
+	//état dépilé et état atteint spontanément
+	int etat,arrivee;
+
+	//compteurs de boucle
+	int i,j,k,v,w;
+
+	if(automate->nbEtats > AFND_BITS_MAX)
+	{
+		return 0;
+	}
+
+	bits->nbEtats = automate->nbEtats;
+	bits->nbMots = (automate->nbEtats + 63) / 64;
+	if(bits->nbMots == 0)
+	{
+		bits->nbMots = 1;
+	}
+	bits->nbClasses = calculerClassesAFND(automate, bits->classe);
+	for (i = 255; i >= 0; i--)
+	{
+		representant[bits->classe[i]] = i;
+	}
+
+	//les transitions spontanées sont absorbées dans les vecteurs : un état atteint apporte toute sa fermeture
+	fermeture = calloc((size_t)bits->nbEtats*bits->nbMots, sizeof(uint64_t));
+	pile = malloc(sizeof(int)*(bits->nbEtats + 1));
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		masque = &fermeture[(size_t)i*bits->nbMots];
+		masque[i/64] |= (uint64_t)1 << (i%64);
+		pile[0] = i;
+		taillePile = 1;
+		while(taillePile > 0)
+		{
+			taillePile--;
+			etat = pile[taillePile];
+			for (j = 0; j < automate->nbEpsilons[etat]; j++)
+			{
+				arrivee = automate->epsilon[etat][j];
+				if(!((masque[arrivee/64] >> (arrivee%64)) & 1))
+				{
+					masque[arrivee/64] |= (uint64_t)1 << (arrivee%64);
+					pile[taillePile] = arrivee;
+					taillePile++;
+				}
+			}
+		}
+	}
+
+	bits->initial = calloc(bits->nbMots, sizeof(uint64_t));
+	bits->final = calloc(bits->nbMots, sizeof(uint64_t));
+	for (i = 0; i < automate->nbEtatsInitiaux; i++)
+	{
+		for (w = 0; w < bits->nbMots; w++)
+		{
+			bits->initial[w] |= fermeture[(size_t)automate->initial[i]*bits->nbMots + w];
+		}
+	}
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		bits->final[automate->final[i]/64] |= (uint64_t)1 << (automate->final[i]%64);
+	}
+
+	//une transition ajoute son arrivée aux successeurs de son départ pour chaque classe dont le représentant est dans l'intervalle
+	bits->successeur = calloc((size_t)bits->nbClasses*bits->nbEtats*bits->nbMots, sizeof(uint64_t));
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		for (j = 0; j < automate->nbTransitions[i]; j++)
+		{
+			arc = &automate->transition[i][j];
+			for (k = 0; k < bits->nbClasses; k++)
+			{
+				if(arc->debut <= representant[k] && representant[k] <= arc->fin)
+				{
+					masque = &bits->successeur[((size_t)k*bits->nbEtats + i)*bits->nbMots];
+					for (w = 0; w < bits->nbMots; w++)
+					{
+						masque[w] |= fermeture[(size_t)arc->arrivee*bits->nbMots + w];
+					}
+				}
+			}
+		}
+	}
+	free(fermeture);
+	free(pile);
+
+	//jusqu'à 64 états, la table d'un groupe de 8 états se remplit valeur par valeur :
+	//les successeurs de v sont ceux de v privé de son bit le plus faible plus ceux de l'état de ce bit
+	bits->table = NULL;
+	if(bits->nbMots == 1)
+	{
+		bits->table = calloc((size_t)bits->nbClasses*8*256, sizeof(uint64_t));
+		for (k = 0; k < bits->nbClasses; k++)
+		{
+			for (j = 0; j < 8; j++)
+			{
+				for (v = 1; v < 256; v++)
+				{
+					i = j*8 + __builtin_ctz(v);
+					bits->table[(k*8 + j)*256 + v] = bits->table[(k*8 + j)*256 + (v & (v-1))];
+					if(i < bits->nbEtats)
+					{
+						bits->table[(k*8 + j)*256 + v] |= bits->successeur[(size_t)k*bits->nbEtats + i];
+					}
+				}
+			}
+		}
+	}
+	return 1;
+}
+
+void desallouerAFNDBits(AFNDBits* bits)
+{
+	free(bits->initial);
+	free(bits->final);
+	free(bits->successeur);
+	free(bits->table);
+}
+
+int est_reconnu_bits(char* mot, int longueurMot, AFNDBits* bits)
+{
+	//états actifs jusqu'à 64 états
+	uint64_t actifs;
+
+	//états actifs au delà de 64 états, avant et après lecture du caractère
+	uint64_t courant[AFND_BITS_MAX/64];
+	uint64_t suivant[AFND_BITS_MAX/64];
+
+	//bits restant à parcourir dans un mot machine
+	uint64_t reste;
+
+	//table des groupes de 8 états pour la classe lue
+	uint64_t* table;
+
+	//vecteur des successeurs d'un état actif
+	uint64_t* masque;
+
+	//booléen indiquant si au moins un état est actif
+	uint64_t vivant;
+
+	//compteurs de boucle
+	int i,j,m,w;
+
+	if(bits->nbMots == 1)
+	{
+		actifs = bits->initial[0];
+		for (i = 0; i < longueurMot && actifs != 0; i++)
+		{
+			table = &bits->table[(size_t)bits->classe[(unsigned char)mot[i]]*8*256];
+			actifs = table[actifs & 0xFF]
+				| table[256 + ((actifs >> 8) & 0xFF)]
+				| table[2*256 + ((actifs >> 16) & 0xFF)]
+				| table[3*256 + ((actifs >> 24) & 0xFF)]
+				| table[4*256 + ((actifs >> 32) & 0xFF)]
+				| table[5*256 + ((actifs >> 40) & 0xFF)]
+				| table[6*256 + ((actifs >> 48) & 0xFF)]
+				| table[7*256 + (actifs >> 56)];
+		}
+		return (actifs & bits->final[0]) != 0;
+	}
+
+	memcpy(courant, bits->initial, sizeof(uint64_t)*bits->nbMots);
+	for (i = 0; i < longueurMot; i++)
+	{
+		memset(suivant, 0, sizeof(uint64_t)*bits->nbMots);
+		masque = &bits->successeur[(size_t)bits->classe[(unsigned char)mot[i]]*bits->nbEtats*bits->nbMots];
+		//on ne parcourt que les états actifs, un bit à la fois
+		for (w = 0; w < bits->nbMots; w++)
+		{
+			reste = courant[w];
+			while(reste != 0)
+			{
+				j = w*64 + __builtin_ctzll(reste);
+				reste &= reste - 1;
+				for (m = 0; m < bits->nbMots; m++)
+				{
+					suivant[m] |= masque[(size_t)j*bits->nbMots + m];
+				}
+			}
+		}
+		vivant = 0;
+		for (w = 0; w < bits->nbMots; w++)
+		{
+			courant[w] = suivant[w];
+			vivant |= suivant[w];
+		}
+		//plus aucun état actif : le mot est rejeté
+		if(vivant == 0)
+		{
+			return 0;
+		}
+	}
+
+	for (w = 0; w < bits->nbMots; w++)
+	{
+		if(courant[w] & bits->final[w])
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+//prend le prochain bloc de la file d'un thread, retourne faux si la file est vide
+static int prendreBloc(FileBlocs* file, int* bloc)
+{
+	int trouve;
+
+	pthread_mutex_lock(&file->verrou);
+	trouve = file->debut < file->fin;
+	if(trouve)
+	{
+		*bloc = file->debut;
+		file->debut++;
+	}
+	pthread_mutex_unlock(&file->verrou);
+	return trouve;
+}
+
+//vole la moitié des blocs restants d'un autre thread et les range dans la file du voleur, retourne faux si aucun thread n'a de bloc
+static int volerBlocs(PoolThreads* pool, int voleur)
+{
+	//file examinée
+	FileBlocs* victime;
+
+	//intervalle de blocs volés
+	int debut,fin;
+
+	//compteur de boucle
+	int i;
+
+	for (i = 1; i < pool->nbThreads; i++)
+	{
+		victime = &pool->files[(voleur + i) % pool->nbThreads];
+		pthread_mutex_lock(&victime->verrou);
+		fin = victime->fin;
+		debut = fin - (victime->fin - victime->debut + 1) / 2;
+		victime->fin = debut;
+		pthread_mutex_unlock(&victime->verrou);
+		if(debut < fin)
+		{
+			pthread_mutex_lock(&pool->files[voleur].verrou);
+			pool->files[voleur].debut = debut;
+			pool->files[voleur].fin = fin;
+			pthread_mutex_unlock(&pool->files[voleur].verrou);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+//boucle d'un thread du pool : attend une tâche, traite ses blocs puis ceux qu'il vole, et recommence
+static void* executerThread(void* argument)
+{
+	PoolThreads* pool = ((ArgumentThread*)argument)->pool;
+	int numero = ((ArgumentThread*)argument)->numero;
+
+	//dernière tâche traitée par ce thread
+	int generation;
+
+	//bloc en cours et ses bornes
+	int bloc,debut,fin;
+
+	free(argument);
+	generation = 0;
+	for (;;)
+	{
+		pthread_mutex_lock(&pool->verrou);
+		while(!pool->arret && pool->generation == generation)
+		{
+			pthread_cond_wait(&pool->travail, &pool->verrou);
+		}
+		if(pool->arret)
+		{
+			pthread_mutex_unlock(&pool->verrou);
+			return NULL;
+		}
+		generation = pool->generation;
+		pthread_mutex_unlock(&pool->verrou);
+
+		do
+		{
+			while(prendreBloc(&pool->files[numero], &bloc))
+			{
+				debut = bloc * pool->tailleBloc;
+				fin = debut + pool->tailleBloc;
+				if(fin > pool->nbElements)
+				{
+					fin = pool->nbElements;
+				}
+				pool->tache(pool->contexte, debut, fin);
+			}
+		}
+		while(volerBlocs(pool, numero));
+
+		pthread_mutex_lock(&pool->verrou);
+		pool->actifs--;
+		if(pool->actifs == 0)
+		{
+			pthread_cond_signal(&pool->termine);
+		}
+		pthread_mutex_unlock(&pool->verrou);
+	}
+}
+
+void creerPoolThreads(PoolThreads* pool, int nbThreads)
+{
+	//argument du thread démarré, libéré par le thread lui-même
+	ArgumentThread* argument;
+
+	//compteur de boucle
+	int i;
+
+	if(nbThreads <= 0)
+	{
+		nbThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+		if(nbThreads <= 0)
+		{
+			nbThreads = 1;
+		}
+	}
+	pool->nbThreads = nbThreads;
+	pool->generation = 0;
+	pool->actifs = 0;
+	pool->arret = 0;
+	pthread_mutex_init(&pool->verrou, NULL);
+	pthread_cond_init(&pool->travail, NULL);
+	pthread_cond_init(&pool->termine, NULL);
+
+	pool->files = malloc(sizeof(FileBlocs)*nbThreads);
+	for (i = 0; i < nbThreads; i++)
+	{
+		pthread_mutex_init(&pool->files[i].verrou, NULL);
+		pool->files[i].debut = 0;
+		pool->files[i].fin = 0;
+	}
+
+	pool->threads = malloc(sizeof(pthread_t)*nbThreads);
+	for (i = 0; i < nbThreads; i++)
+	{
+		argument = malloc(sizeof(ArgumentThread));
+		argument->pool = pool;
+		argument->numero = i;
+		pthread_create(&pool->threads[i], NULL, executerThread, argument);
+	}
+}
+
+void detruirePoolThreads(PoolThreads* pool)
+{
+	//compteur de boucle
+	int i;
+
+	pthread_mutex_lock(&pool->verrou);
+	pool->arret = 1;
+	pthread_cond_broadcast(&pool->travail);
+	pthread_mutex_unlock(&pool->verrou);
+
+	for (i = 0; i < pool->nbThreads; i++)
+	{
+		pthread_join(pool->threads[i], NULL);
+		pthread_mutex_destroy(&pool->files[i].verrou);
+	}
+	pthread_mutex_destroy(&pool->verrou);
+	pthread_cond_destroy(&pool->travail);
+	pthread_cond_destroy(&pool->termine);
+	free(pool->threads);
+	free(pool->files);
+}
+
+void executerParallele(PoolThreads* pool, int nbElements, int tailleBloc, void (*tache)(void* contexte, int debut, int fin), void* contexte)
+{
+	//nombre total de blocs
+	int nbBlocs;
+
+	//compteur de boucle
+	int i;
+
+	if(nbElements <= 0)
+	{
+		return;
+	}
+	nbBlocs = (nbElements + tailleBloc - 1) / tailleBloc;
+
+	//chaque thread reçoit au départ une part égale de blocs consécutifs, les déséquilibres sont ensuite corrigés par vol
+	for (i = 0; i < pool->nbThreads; i++)
+	{
+		pthread_mutex_lock(&pool->files[i].verrou);
+		pool->files[i].debut = (int)((long)nbBlocs * i / pool->nbThreads);
+		pool->files[i].fin = (int)((long)nbBlocs * (i+1) / pool->nbThreads);
+		pthread_mutex_unlock(&pool->files[i].verrou);
+	}
+
+	pthread_mutex_lock(&pool->verrou);
+	pool->tache = tache;
+	pool->contexte = contexte;
+	pool->nbElements = nbElements;
+	pool->tailleBloc = tailleBloc;
+	pool->actifs = pool->nbThreads;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->travail);
+	while(pool->actifs > 0)
+	{
+		pthread_cond_wait(&pool->termine, &pool->verrou);
+	}
+	pthread_mutex_unlock(&pool->verrou);
+}
+
+//teste les mots [debut, fin[ d'un lot, debut étant un multiple de 8 les octets de résultats écrits ne sont partagés avec aucun autre bloc
+static void tacheLot(void* contexte, int debut, int fin)
+{
+	ContexteLot* lot = contexte;
+
+	reconnaitreLotAccepteur(lot->mots + debut, fin - debut, lot->automate, lot->accepteur, lot->resultats + debut/8);
+}
+
+void reconnaitreLotParallele(Mot* mots, int nbMots, AFD* automate, unsigned char* resultats, PoolThreads* pool)
+{
+	//contexte partagé par tous les blocs
+	ContexteLot lot;
+
+	//compteur de boucle
+	int i;
+
+	lot.mots = mots;
+	lot.automate = automate;
+	lot.resultats = resultats;
+	lot.accepteur = calloc(automate->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		lot.accepteur[automate->final[i]] = 1;
+	}
+
+	executerParallele(pool, nbMots, TAILLE_BLOC_LOT, tacheLot, &lot);
+
+	free(lot.accepteur);
+}
+
+//lit un tronçon de texte depuis chacun des états de l'automate et range dans carte l'état atteint depuis chacun d'eux, -1 si le tronçon est rejeté
+//les états courants qui se rejoignent ne sont plus suivis qu'une fois, ce qui arrive vite sur un automate minimal
+static void parcourirTronconTousEtats(char* texte, size_t longueur, AFD* automate, int* carte)
+{
+	//états courants distincts, carte[e] est l'indice dans ce tableau de l'état courant partant de e
+	int* distincts;
+	int nbDistincts;
+
+	//nouvel indice de chaque état lors de la fusion des états courants identiques, -1 si l'état n'est pas courant
+	int* indice;
+
+	//nouvel indice de chaque ancien indice d'état courant
+	int* renumerotation;
+
+	//fenêtre de caractères lue entre deux fusions, doublée quand une fusion ne gagne rien
+	size_t fenetre;
+
+	//état courant
+	int etat;
+
+	//numéro de l'état représentant un mot rejeté
+	int rejet;
+
+	//position dans le tronçon et fin de la fenêtre courante
+	size_t i,j,fin;
+
+	//compteurs de boucle
+	int e,k,nb;
+
+	distincts = malloc(sizeof(int)*automate->nbEtats);
+	indice = malloc(sizeof(int)*(automate->nbEtats + 1));
+	renumerotation = malloc(sizeof(int)*automate->nbEtats);
+	for (e = 0; e < automate->nbEtats; e++)
+	{
+		distincts[e] = e;
+		carte[e] = e;
+		indice[e] = -1;
+	}
+	rejet = automate->nbEtats;
+	indice[rejet] = -1;
+	nbDistincts = automate->nbEtats;
+
+	fenetre = 32;
+	i = 0;
+	while(i < longueur)
+	{
+		fin = i + fenetre < longueur ? i + fenetre : longueur;
+		//chaque état courant lit toute la fenêtre avant de passer au suivant
+		for (k = 0; k < nbDistincts; k++)
+		{
+			etat = distincts[k];
+			for (j = i; j < fin && etat != rejet; j++)
+			{
+				etat = automate->transition[automate->classe[(unsigned char)texte[j]]][etat];
+				if(etat == -1)
+				{
+					etat = rejet;
+				}
+			}
+			distincts[k] = etat;
+		}
+		i = fin;
+
+		if(nbDistincts > 1)
+		{
+			nb = 0;
+			for (k = 0; k < nbDistincts; k++)
+			{
+				if(indice[distincts[k]] == -1)
+				{
+					indice[distincts[k]] = nb;
+					distincts[nb] = distincts[k];
+					nb++;
+				}
+				renumerotation[k] = indice[distincts[k]];
+			}
+			for (k = 0; k < nb; k++)
+			{
+				indice[distincts[k]] = -1;
+			}
+			if(nb < nbDistincts)
+			{
+				for (e = 0; e < automate->nbEtats; e++)
+				{
+					carte[e] = renumerotation[carte[e]];
+				}
+				nbDistincts = nb;
+			}
+			else if(fenetre < 4096)
+			{
+				fenetre *= 2;
+			}
+		}
+		else if(distincts[0] == rejet)
+		{
+			//tous les états de départ rejettent déjà le mot : la suite du tronçon ne change plus rien
+			break;
+		}
+		else
+		{
+			//un seul état courant : le reste du tronçon est lu d'une traite
+			fenetre = longueur - i;
+		}
+	}
+
+	for (e = 0; e < automate->nbEtats; e++)
+	{
+		carte[e] = distincts[carte[e]] == rejet ? -1 : distincts[carte[e]];
+	}
+
+	free(distincts);
+	free(indice);
+	free(renumerotation);
+}
+
+//calcule la carte des tronçons [debut, fin[, le premier tronçon n'est lu que depuis l'état initial
+static void tacheTroncons(void* contexte, int debut, int fin)
+{
+	ContexteTroncons* troncons = contexte;
+	AFD* automate = troncons->automate;
+
+	//bornes du tronçon dans le texte
+	size_t premier,dernier;
+
+	//compteur de boucle
+	int t;
+
+	for (t = debut; t < fin; t++)
+	{
+		premier = t * troncons->tailleTroncon;
+		dernier = premier + troncons->tailleTroncon;
+		if(dernier > troncons->longueur)
+		{
+			dernier = troncons->longueur;
+		}
+		if(t > 0)
+		{
+			parcourirTronconTousEtats(troncons->texte + premier, dernier - premier, automate, &troncons->cartes[(size_t)t*automate->nbEtats]);
+			continue;
+		}
+		troncons->cartes[automate->initial] = avancerAFD(automate, automate->initial, troncons->texte + premier, dernier - premier);
+	}
+}
+
+int est_reconnu_parallele(char* mot, size_t longueurMot, AFD* automate, PoolThreads* pool)
+{
+	//contexte partagé par les tronçons
+	ContexteTroncons troncons;
+
+	//nombre de tronçons
+	int nbTroncons;
+
+	//état atteint à la fin du texte
+	int etat;
+
+	//compteur de boucle
+	int t;
+
+	//quelques tronçons par thread pour que le vol de travail équilibre les tronçons lents à converger
+	nbTroncons = 4 * pool->nbThreads;
+	if(longueurMot / TAILLE_TRONCON_MIN < (size_t)nbTroncons)
+	{
+		nbTroncons = (int)(longueurMot / TAILLE_TRONCON_MIN);
+	}
+	if(nbTroncons < 1)
+	{
+		nbTroncons = 1;
+	}
+
+	troncons.texte = mot;
+	troncons.longueur = longueurMot;
+	troncons.tailleTroncon = (longueurMot + nbTroncons - 1) / nbTroncons;
+	troncons.automate = automate;
+	troncons.cartes = malloc(sizeof(int)*nbTroncons*automate->nbEtats);
+
+	if(nbTroncons == 1)
+	{
+		tacheTroncons(&troncons, 0, 1);
+	}
+	else
+	{
+		executerParallele(pool, nbTroncons, 1, tacheTroncons, &troncons);
+	}
+
+	//enchaînement des cartes depuis l'état initial, arrêté dès que le mot est rejeté
+	etat = automate->initial;
+	for (t = 0; t < nbTroncons && etat != -1; t++)
+	{
+		etat = troncons.cartes[(size_t)t*automate->nbEtats + etat];
+	}
+	free(troncons.cartes);
+
+	return estFinalAFD(automate, etat);
+}
+
+void debuterFlux(FluxAFD* flux, AFD* automate)
+{
+	flux->automate = automate;
+	flux->etat = automate->initial;
+}
+
+void alimenterFlux(FluxAFD* flux, char* morceau, size_t taille)
+{
+	flux->etat = avancerAFD(flux->automate, flux->etat, morceau, taille);
+}
+
+int terminerFlux(FluxAFD* flux)
+{
+	return estFinalAFD(flux->automate, flux->etat);
+}
+
+int reconnaitreDescripteur(int descripteur, AFD* automate)
+{
+	//lecture en cours
+	FluxAFD flux;
+
+	//tampon de lecture, sur la pile pour ne rien allouer
+	char tampon[TAILLE_TAMPON_FLUX];
+
+	//nombre d'octets lus par le dernier appel à read
+	ssize_t lus;
+
+	debuterFlux(&flux, automate);
+	for (;;)
+	{
+		lus = read(descripteur, tampon, sizeof(tampon));
+		if(lus > 0)
+		{
+			alimenterFlux(&flux, tampon, lus);
+			//le mot est déjà rejeté, il est inutile de lire la suite
+			if(flux.etat == -1)
+			{
+				return 0;
+			}
+		}
+		else if(lus == 0)
+		{
+			return terminerFlux(&flux);
+		}
+		else if(errno != EINTR)
+		{
+			return -1;
+		}
+	}
+}
+
+int reconnaitreFichier(const char* chemin, AFD* automate)
+{
+	//lecture en cours
+	FluxAFD flux;
+
+	//taille du fichier
+	struct stat informations;
+
+	//descripteur et projection du fichier
+	int descripteur;
+	char* projection;
+
+	descripteur = open(chemin, O_RDONLY);
+	if(descripteur < 0)
+	{
+		return -1;
+	}
+	if(fstat(descripteur, &informations) < 0)
+	{
+		close(descripteur);
+		return -1;
+	}
+
+	debuterFlux(&flux, automate);
+	//un fichier vide ne peut être projeté, c'est le mot vide
+	if(informations.st_size > 0)
+	{
+		projection = mmap(NULL, informations.st_size, PROT_READ, MAP_PRIVATE, descripteur, 0);
+		if(projection == MAP_FAILED)
+		{
+			close(descripteur);
+			return -1;
+		}
+		madvise(projection, informations.st_size, MADV_SEQUENTIAL);
+		alimenterFlux(&flux, projection, informations.st_size);
+		munmap(projection, informations.st_size);
+	}
+	close(descripteur);
+	return terminerFlux(&flux);
+}
+
+void construireAFNDTousLesMots(AFND* automate)
+{
+	//un seul état initial et final qui boucle sur tous les caractères
+	construireAFNDVierge(automate, 1, 1, 1);
+	automate->initial[0] = 0;
+	automate->final[0] = 0;
+	ajouterTransitionAFND(automate, 0, 0, 0, 255);
+}
+
+void inverserAFND(AFND* automate, AFND* inverse)
+{
+	//transition retournée
+	Arc* arc;
+
+	//compteurs de boucle
+	int i,j;
+
+	//les états initiaux deviennent finaux et inversement
+	construireAFNDVierge(inverse, automate->nbEtats, automate->nbEtatsFinaux, automate->nbEtatsInitiaux);
+	memcpy(inverse->initial, automate->final, sizeof(int)*automate->nbEtatsFinaux);
+	memcpy(inverse->final, automate->initial, sizeof(int)*automate->nbEtatsInitiaux);
+
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		for (j = 0; j < automate->nbTransitions[i]; j++)
+		{
+			arc = &automate->transition[i][j];
+			ajouterTransitionAFND(inverse, arc->arrivee, i, arc->debut, arc->fin);
+		}
+		for (j = 0; j < automate->nbEpsilons[i]; j++)
+		{
+			ajouterEpsilonAFND(inverse, automate->epsilon[i][j], i);
+		}
+	}
+}
+
+//déterminise et minimise un automate non déterministe et calcule le tableau de ses états finaux
+static unsigned char* construireAFDRecherche(AFND* automate, AFD* minimal)
+{
+	//automate déterministe avant minimisation
+	AFD deter;
+
+	//tableau des états finaux
+	unsigned char* accepteur;
+
+	//compteur de boucle
+	int i;
+
+	determiniser(automate, &deter);
+	minimiserHopcroft(&deter, minimal);
+	desallouerAFD(&deter);
+
+	accepteur = calloc(minimal->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < minimal->nbEtatsFinaux; i++)
+	{
+		accepteur[minimal->final[i]] = 1;
+	}
+	return accepteur;
+}
+
+void preparerRecherche(AFND* automate, Recherche* recherche)
+{
+	//automates intermédiaires
+	AFND tousLesMots;
+	AFND inverse;
+	AFND nonAncre;
+
+	construireAFNDTousLesMots(&tousLesMots);
+	inverserAFND(automate, &inverse);
+
+	recherche->accepteurAncre = construireAFDRecherche(automate, &recherche->ancre);
+	recherche->accepteurArriere = construireAFDRecherche(&inverse, &recherche->arriere);
+
+	concatenationAFND(&tousLesMots, automate, &nonAncre);
+	recherche->accepteurAvant = construireAFDRecherche(&nonAncre, &recherche->avant);
+	desallouerAFND(&nonAncre);
+
+	concatenationAFND(&tousLesMots, &inverse, &nonAncre);
+	recherche->accepteurArriereNonAncre = construireAFDRecherche(&nonAncre, &recherche->arriereNonAncre);
+	desallouerAFND(&nonAncre);
+
+	desallouerAFND(&inverse);
+	desallouerAFND(&tousLesMots);
+}
+
+void desallouerRecherche(Recherche* recherche)
+{
+	desallouerAFD(&recherche->ancre);
+	desallouerAFD(&recherche->avant);
+	desallouerAFD(&recherche->arriere);
+	desallouerAFD(&recherche->arriereNonAncre);
+	free(recherche->accepteurAncre);
+	free(recherche->accepteurAvant);
+	free(recherche->accepteurArriere);
+	free(recherche->accepteurArriereNonAncre);
+}
+
+//ajoute une occurrence au tableau, dont la capacité double quand il est plein
+static void ajouterOccurrence(Occurrence** occurrences, size_t* nombre, size_t* capacite, size_t debut, size_t fin)
+{
+	if(*nombre == *capacite)
+	{
+		*capacite = *capacite ? 2 * *capacite : 16;
+		*occurrences = realloc(*occurrences, sizeof(Occurrence) * *capacite);
+	}
+	(*occurrences)[*nombre].debut = debut;
+	(*occurrences)[*nombre].fin = fin;
+	(*nombre)++;
+}
+
+//dans les recherches une transition absente mène à un état mort d'où aucune occurrence n'est plus possible
+size_t rechercherPlusLonguesAGauche(char* texte, size_t longueur, Recherche* recherche, Occurrence** occurrences)
+{
+	//debuts[i/8] contient le bit i%8 si une occurrence commence à la position i
+	unsigned char* debuts;
+
+	//tableau des occurrences, son nombre d'éléments et sa capacité
+	size_t nombre,capacite;
+
+	//état courant
+	int etat;
+
+	//fin de l'occurrence la plus longue depuis le début courant, ou longueur+1 si aucune
+	size_t fin;
+
+	//positions dans le texte
+	size_t i,j;
+
+	*occurrences = NULL;
+	nombre = 0;
+	capacite = 0;
+
+	//passe vers l'arrière : l'état après lecture à l'envers de texte[i..longueur[ est final si une occurrence commence en i
+	debuts = calloc(longueur/8 + 1, sizeof(unsigned char));
+	etat = recherche->arriereNonAncre.initial;
+	i = longueur;
+	for (;;)
+	{
+		if(recherche->accepteurArriereNonAncre[etat])
+		{
+			debuts[i/8] |= 1 << (i%8);
+		}
+		if(i == 0)
+		{
+			break;
+		}
+		i--;
+		etat = recherche->arriereNonAncre.transition[recherche->arriereNonAncre.classe[(unsigned char)texte[i]]][etat];
+		if(etat == -1)
+		{
+			break;
+		}
+	}
+
+	//passe vers l'avant : depuis chaque début retenu on cherche la fin la plus lointaine
+	i = 0;
+	while(i <= longueur)
+	{
+		if(!(debuts[i/8] & (1 << (i%8))))
+		{
+			i++;
+			continue;
+		}
+		etat = recherche->ancre.initial;
+		fin = longueur + 1;
+		for (j = i; ; j++)
+		{
+			if(recherche->accepteurAncre[etat])
+			{
+				fin = j;
+			}
+			if(j == longueur)
+			{
+				break;
+			}
+			etat = recherche->ancre.transition[recherche->ancre.classe[(unsigned char)texte[j]]][etat];
+			if(etat == -1)
+			{
+				break;
+			}
+		}
+		ajouterOccurrence(occurrences, &nombre, &capacite, i, fin);
+		i = fin > i ? fin : i + 1;
+	}
+
+	free(debuts);
+	return nombre;
+}
+
+size_t rechercherToutes(char* texte, size_t longueur, Recherche* recherche, Occurrence** occurrences)
+{
+	//tableau des occurrences, son nombre d'éléments et sa capacité
+	size_t nombre,capacite;
+
+	//état de la passe vers l'avant et état de la remontée vers les débuts
+	int etat,retour;
+
+	//positions dans le texte
+	size_t i,j;
+
+	*occurrences = NULL;
+	nombre = 0;
+	capacite = 0;
+
+	//l'état après lecture de texte[0..j[ est final si une occurrence finit en j
+	etat = recherche->avant.initial;
+	for (j = 0; ; j++)
+	{
+		if(recherche->accepteurAvant[etat])
+		{
+			//on remonte depuis j avec le langage inversé tant que l'état n'est pas mort
+			retour = recherche->arriere.initial;
+			i = j;
+			for (;;)
+			{
+				if(recherche->accepteurArriere[retour])
+				{
+					ajouterOccurrence(occurrences, &nombre, &capacite, i, j);
+				}
+				if(i == 0)
+				{
+					break;
+				}
+				i--;
+				retour = recherche->arriere.transition[recherche->arriere.classe[(unsigned char)texte[i]]][retour];
+				if(retour == -1)
+				{
+					break;
+				}
+			}
+		}
+		if(j == longueur)
+		{
+			break;
+		}
+		etat = recherche->avant.transition[recherche->avant.classe[(unsigned char)texte[j]]][etat];
+		if(etat == -1)
+		{
+			break;
+		}
+	}
+
+	return nombre;
+}
+
+//ajoute un noeud à l'arbre et retourne son indice
+static int ajouterNoeud(AnalyseurExpression* analyseur, int type, int gauche, int droite)
+{
+	NoeudExpression* noeud;
+
+	if(analyseur->nbNoeuds == analyseur->capaciteNoeuds)
+	{
+		analyseur->capaciteNoeuds = analyseur->capaciteNoeuds ? 2 * analyseur->capaciteNoeuds : 16;
+		analyseur->noeuds = reallouerArene(areneCourante, analyseur->noeuds, sizeof(NoeudExpression) * analyseur->capaciteNoeuds);
+	}
+	noeud = &analyseur->noeuds[analyseur->nbNoeuds];
+	noeud->type = type;
+	noeud->gauche = gauche;
+	noeud->droite = droite;
+	memset(noeud->ensemble, 0, sizeof(noeud->ensemble));
+	return analyseur->nbNoeuds++;
+}
+
+//ajoute les caractères de debut à fin à un ensemble
+static void ajouterIntervalleEnsemble(unsigned char* ensemble, int debut, int fin)
+{
+	int c;
+
+	for (c = debut; c <= fin; c++)
+	{
+		ensemble[c/8] |= 1 << (c%8);
+	}
+}
+
+//lit le caractère qui suit un \ : ajoute à l'ensemble la classe \d, \w ou \s et retourne -1, ou retourne le caractère désigné
+//retourne -2 si l'expression se termine par un \ isolé
+static int lireEchappement(AnalyseurExpression* analyseur, unsigned char* ensemble)
+{
+	unsigned char c;
+
+	c = analyseur->expression[analyseur->position];
+	if(c == '\0')
+	{
+		return -2;
+	}
+	analyseur->position++;
+	switch(c)
+	{
+		case 'n':
+			return '\n';
+		case 't':
+			return '\t';
+		case 'r':
+			return '\r';
+		case 'd':
+			ajouterIntervalleEnsemble(ensemble, '0', '9');
+			return -1;
+		case 'w':
+			ajouterIntervalleEnsemble(ensemble, '0', '9');
+			ajouterIntervalleEnsemble(ensemble, 'a', 'z');
+			ajouterIntervalleEnsemble(ensemble, 'A', 'Z');
+			ajouterIntervalleEnsemble(ensemble, '_', '_');
+			return -1;
+		case 's':
+			ajouterIntervalleEnsemble(ensemble, ' ', ' ');
+			ajouterIntervalleEnsemble(ensemble, '\t', '\r');
+			return -1;
+		default:
+			return c;
+	}
+}
+
+//lit une classe [...] dont le [ a déjà été lu, retourne l'indice du noeud ou -1 si la classe est mal formée
+static int analyserClasse(AnalyseurExpression* analyseur)
+{
+	//ensemble en construction
+	unsigned char ensemble[32];
+
+	//booléen indiquant une classe complémentée [^...]
+	int complement;
+
+	//bornes de l'intervalle lu
+	int debut,fin;
+
+	//noeud construit
+	int noeud;
+
+	//compteur de boucle
+	int i;
+
+	memset(ensemble, 0, sizeof(ensemble));
+	complement = analyseur->expression[analyseur->position] == '^';
+	if(complement)
+	{
+		analyseur->position++;
+	}
+
+	//un ] en tête de classe est un caractère comme un autre
+	if(analyseur->expression[analyseur->position] == ']')
+	{
+		ajouterIntervalleEnsemble(ensemble, ']', ']');
+		analyseur->position++;
+	}
+
+	while(analyseur->expression[analyseur->position] != ']')
+	{
+		debut = (unsigned char)analyseur->expression[analyseur->position];
+		if(debut == '\0')
+		{
+			return -1;
+		}
+		analyseur->position++;
+		if(debut == '\\')
+		{
+			debut = lireEchappement(analyseur, ensemble);
+			if(debut == -2)
+			{
+				return -1;
+			}
+			if(debut == -1)
+			{
+				continue;
+			}
+		}
+
+		fin = debut;
+		if(analyseur->expression[analyseur->position] == '-' && analyseur->expression[analyseur->position+1] != ']' && analyseur->expression[analyseur->position+1] != '\0')
+		{
+			analyseur->position++;
+			fin = (unsigned char)analyseur->expression[analyseur->position];
+			analyseur->position++;
+			if(fin == '\\')
+			{
+				fin = lireEchappement(analyseur, ensemble);
+				if(fin < 0)
+				{
+					return -1;
+				}
+			}
+			if(fin < debut)
+			{
+				return -1;
+			}
+		}
+		ajouterIntervalleEnsemble(ensemble, debut, fin);
+	}
+	analyseur->position++;
+
+	noeud = ajouterNoeud(analyseur, NOEUD_ENSEMBLE, -1, -1);
+	for (i = 0; i < 32; i++)
+	{
+		analyseur->noeuds[noeud].ensemble[i] = complement ? ~ensemble[i] : ensemble[i];
+	}
+	return noeud;
+}
+
+static int analyserUnion(AnalyseurExpression* analyseur);
+
+//lit un caractère, une classe ou une expression entre parenthèses, retourne l'indice du noeud ou -1 en cas d'erreur
+static int analyserAtome(AnalyseurExpression* analyseur)
+{
+	//caractère lu
+	int c;
+
+	//noeud construit
+	int noeud;
+
+	c = (unsigned char)analyseur->expression[analyseur->position];
+	analyseur->position++;
+	switch(c)
+	{
+		case '(':
+			noeud = analyserUnion(analyseur);
+			if(noeud == -1 || analyseur->expression[analyseur->position] != ')')
+			{
+				return -1;
+			}
+			analyseur->position++;
+			return noeud;
+		case '[':
+			return analyserClasse(analyseur);
+		case '.':
+			//le point reconnaît tous les caractères sauf le retour à la ligne
+			noeud = ajouterNoeud(analyseur, NOEUD_ENSEMBLE, -1, -1);
+			ajouterIntervalleEnsemble(analyseur->noeuds[noeud].ensemble, 0, 255);
+			analyseur->noeuds[noeud].ensemble['\n'/8] &= ~(1 << ('\n'%8));
+			return noeud;
+		case '*':
+		case '+':
+		case '?':
+		case '{':
+			//opérateur de répétition sans rien à répéter
+			return -1;
+		case '\\':
+			noeud = ajouterNoeud(analyseur, NOEUD_ENSEMBLE, -1, -1);
+			c = lireEchappement(analyseur, analyseur->noeuds[noeud].ensemble);
+			if(c == -2)
+			{
+				return -1;
+			}
+			if(c >= 0)
+			{
+				ajouterIntervalleEnsemble(analyseur->noeuds[noeud].ensemble, c, c);
+			}
+			return noeud;
+		default:
+			noeud = ajouterNoeud(analyseur, NOEUD_ENSEMBLE, -1, -1);
+			ajouterIntervalleEnsemble(analyseur->noeuds[noeud].ensemble, c, c);
+			return noeud;
+	}
+}
+
+//recopie le sous-arbre d'un noeud et retourne l'indice de la copie
+static int copierNoeud(AnalyseurExpression* analyseur, int noeud)
+{
+	//copies des fils et du noeud
+	int gauche,droite,copie;
+
+	gauche = analyseur->noeuds[noeud].gauche == -1 ? -1 : copierNoeud(analyseur, analyseur->noeuds[noeud].gauche);
+	droite = analyseur->noeuds[noeud].droite == -1 ? -1 : copierNoeud(analyseur, analyseur->noeuds[noeud].droite);
+	copie = ajouterNoeud(analyseur, analyseur->noeuds[noeud].type, gauche, droite);
+	memcpy(analyseur->noeuds[copie].ensemble, analyseur->noeuds[noeud].ensemble, 32);
+	return copie;
+}
+
+//construit la répétition {min,max} d'un noeud, max valant -1 pour une répétition non bornée
+//les répétitions facultatives sont imbriquées x(x(x)?)? pour que chaque copie ne suive que la précédente
+static int repeterNoeud(AnalyseurExpression* analyseur, int noeud, int min, int max)
+{
+	//partie facultative, puis répétition complète
+	int suite,resultat;
+
+	//compteur de boucle
+	int i;
+
+	if(max == -1)
+	{
+		suite = ajouterNoeud(analyseur, min == 0 ? NOEUD_ETOILE : NOEUD_PLUS, noeud, -1);
+		if(min > 0)
+		{
+			min--;
+		}
+	}
+	else if(max > min)
+	{
+		suite = ajouterNoeud(analyseur, NOEUD_OPTION, noeud, -1);
+		for (i = min + 1; i < max; i++)
+		{
+			suite = ajouterNoeud(analyseur, NOEUD_CONCATENATION, copierNoeud(analyseur, noeud), suite);
+			suite = ajouterNoeud(analyseur, NOEUD_OPTION, suite, -1);
+		}
+	}
+	else if(min > 0)
+	{
+		//le noeud d'origine sert de première répétition obligatoire
+		suite = noeud;
+		min--;
+	}
+	else
+	{
+		return ajouterNoeud(analyseur, NOEUD_VIDE, -1, -1);
+	}
+
+	resultat = suite;
+	for (i = 0; i < min; i++)
+	{
+		resultat = ajouterNoeud(analyseur, NOEUD_CONCATENATION, copierNoeud(analyseur, noeud), resultat);
+	}
+	return resultat;
+}
+
+//lit un entier décimal d'au plus REPETITION_MAX, retourne -1 si aucun chiffre n'est lu ou si la borne est dépassée
+static int lireEntierExpression(AnalyseurExpression* analyseur)
+{
+	//valeur lue et nombre de chiffres lus
+	int valeur;
+	int chiffres;
+
+	valeur = 0;
+	chiffres = 0;
+	while(analyseur->expression[analyseur->position] >= '0' && analyseur->expression[analyseur->position] <= '9')
+	{
+		valeur = valeur * 10 + analyseur->expression[analyseur->position] - '0';
+		analyseur->position++;
+		chiffres++;
+		if(valeur > REPETITION_MAX)
+		{
+			return -1;
+		}
+	}
+	return chiffres ? valeur : -1;
+}
+
+//lit un atome suivi de ses opérateurs de répétition, retourne l'indice du noeud ou -1 en cas d'erreur
+static int analyserRepetition(AnalyseurExpression* analyseur)
+{
+	//noeud construit
+	int noeud;
+
+	//bornes d'une répétition {min,max}
+	int min,max;
+
+	noeud = analyserAtome(analyseur);
+	while(noeud != -1)
+	{
+		switch(analyseur->expression[analyseur->position])
+		{
+			case '*':
+				noeud = ajouterNoeud(analyseur, NOEUD_ETOILE, noeud, -1);
+				break;
+			case '+':
+				noeud = ajouterNoeud(analyseur, NOEUD_PLUS, noeud, -1);
+				break;
+			case '?':
+				noeud = ajouterNoeud(analyseur, NOEUD_OPTION, noeud, -1);
+				break;
+			case '{':
+				analyseur->position++;
+				min = lireEntierExpression(analyseur);
+				max = min;
+				if(min != -1 && analyseur->expression[analyseur->position] == ',')
+				{
+					analyseur->position++;
+					max = analyseur->expression[analyseur->position] == '}' ? -1 : lireEntierExpression(analyseur);
+					if(max == -1 && analyseur->expression[analyseur->position] != '}')
+					{
+						return -1;
+					}
+				}
+				if(min == -1 || analyseur->expression[analyseur->position] != '}' || (max != -1 && max < min))
+				{
+					return -1;
+				}
+				noeud = repeterNoeud(analyseur, noeud, min, max);
+				break;
+			default:
+				return noeud;
+		}
+		analyseur->position++;
+	}
+	return -1;
+}
+
+//lit une suite de répétitions jusqu'à un |, une ) ou la fin, retourne l'indice du noeud ou -1 en cas d'erreur
+static int analyserConcatenation(AnalyseurExpression* analyseur)
+{
+	//noeud construit et noeud suivant
+	int noeud,suivant;
+
+	//prochain caractère de l'expression
+	char c;
+
+	noeud = -1;
+	for (;;)
+	{
+		c = analyseur->expression[analyseur->position];
+		if(c == '\0' || c == '|' || c == ')')
+		{
+			//une suite vide reconnaît le mot vide
+			return noeud == -1 ? ajouterNoeud(analyseur, NOEUD_VIDE, -1, -1) : noeud;
+		}
+		suivant = analyserRepetition(analyseur);
+		if(suivant == -1)
+		{
+			return -1;
+		}
+		noeud = noeud == -1 ? suivant : ajouterNoeud(analyseur, NOEUD_CONCATENATION, noeud, suivant);
+	}
+}
+
+//lit des concaténations séparées par des |, retourne l'indice du noeud ou -1 en cas d'erreur
+static int analyserUnion(AnalyseurExpression* analyseur)
+{
+	//noeud construit et noeud suivant
+	int noeud,suivant;
+
+	noeud = analyserConcatenation(analyseur);
+	while(noeud != -1 && analyseur->expression[analyseur->position] == '|')
+	{
+		analyseur->position++;
+		suivant = analyserConcatenation(analyseur);
+		if(suivant == -1)
+		{
+			return -1;
+		}
+		noeud = ajouterNoeud(analyseur, NOEUD_UNION, noeud, suivant);
+	}
+	return noeud;
+}
+
+//ajoute une position à une liste
+static void ajouterPosition(ListePositions* liste, int position)
+{
+	if(liste->taille == liste->capacite)
+	{
+		liste->capacite = liste->capacite ? 2 * liste->capacite : 4;
+		liste->elements = reallouerArene(areneCourante, liste->elements, sizeof(int) * liste->capacite);
+	}
+	liste->elements[liste->taille++] = position;
+}
+
+//range dans resultat l'union de deux listes de positions disjointes, les deux listes sont consommées
+//la plus courte est recopiée dans la plus longue pour que les unions en chaîne restent linéaires
+static void fusionnerPositions(ListePositions* liste1, ListePositions* liste2, ListePositions* resultat)
+{
+	ListePositions longue,courte;
+	int i;
+
+	longue = liste1->taille >= liste2->taille ? *liste1 : *liste2;
+	courte = liste1->taille >= liste2->taille ? *liste2 : *liste1;
+	for (i = 0; i < courte.taille; i++)
+	{
+		ajouterPosition(&longue, courte.elements[i]);
+	}
+	libererArene(areneCourante, courte.elements);
+	*resultat = longue;
+}
+
+//ajoute une transition de chaque position de depart vers chaque position d'arrivee, étiquetée par l'ensemble de l'arrivée
+static void relierPositions(AFND* automate, ListePositions* depart, ListePositions* arrivee, int* premierIntervalle, unsigned char* intervalles)
+{
+	int i,j,k;
+
+	for (i = 0; i < depart->taille; i++)
+	{
+		for (j = 0; j < arrivee->taille; j++)
+		{
+			for (k = premierIntervalle[arrivee->elements[j]]; k < premierIntervalle[arrivee->elements[j]+1]; k++)
+			{
+				ajouterTransitionAFND(automate, depart->elements[i], arrivee->elements[j], intervalles[2*k], intervalles[2*k+1]);
+			}
+		}
+	}
+}
+
+int construireAFNDExpression(const char* expression, AFND* automate)
+{
+	//analyse de l'expression
+	AnalyseurExpression analyseur;
+
+	//racine de l'arbre
+	int racine;
+
+	//atteint[i] vaut 1 si le noeud i fait partie de l'arbre de la racine, une répétition {0} laissant des noeuds orphelins
+	unsigned char* atteint;
+
+	//pile du parcours de l'arbre
+	int* pile;
+	int hauteur;
+
+	//pour chaque noeud : booléen indiquant s'il reconnaît le mot vide, positions par lesquelles ses mots commencent et finissent
+	unsigned char* vide;
+	ListePositions* premieres;
+	ListePositions* dernieres;
+
+	//nombre de positions, chacune devenant un état, l'état 0 étant l'état initial
+	int nbPositions;
+
+	//liste réduite à l'état initial
+	ListePositions initial;
+	int etatInitial;
+
+	//intervalles de caractères de chaque position : ceux de la position p sont les couples de intervalles d'indices premierIntervalle[p] à premierIntervalle[p+1] exclus
+	int* premierIntervalle;
+	unsigned char* intervalles;
+	int nbIntervalles;
+
+	//noeud courant et ses fils
+	NoeudExpression* noeud;
+	int g,d;
+
+	//compteurs de boucle
+	int i,c;
+
+	analyseur.expression = expression;
+	analyseur.position = 0;
+	analyseur.noeuds = NULL;
+	analyseur.nbNoeuds = 0;
+	analyseur.capaciteNoeuds = 0;
+	racine = analyserUnion(&analyseur);
+	if(racine == -1 || expression[analyseur.position] != '\0')
+	{
+		libererArene(areneCourante, analyseur.noeuds);
+		return 0;
+	}
+
+	//marquage des noeuds de l'arbre et décompte des positions
+	atteint = allouerZeroArene(areneCourante, analyseur.nbNoeuds, sizeof(unsigned char));
+	pile = allouerArene(areneCourante, sizeof(int)*analyseur.nbNoeuds);
+	hauteur = 0;
+	pile[hauteur++] = racine;
+	atteint[racine] = 1;
+	nbPositions = 0;
+	while(hauteur > 0)
+	{
+		noeud = &analyseur.noeuds[pile[--hauteur]];
+		if(noeud->type == NOEUD_ENSEMBLE)
+		{
+			nbPositions++;
+		}
+		if(noeud->gauche != -1)
+		{
+			atteint[noeud->gauche] = 1;
+			pile[hauteur++] = noeud->gauche;
+		}
+		if(noeud->droite != -1)
+		{
+			atteint[noeud->droite] = 1;
+			pile[hauteur++] = noeud->droite;
+		}
+	}
+	libererArene(areneCourante, pile);
+
+	construireAFNDVierge(automate, nbPositions + 1, 1, 0);
+	automate->initial[0] = 0;
+
+	vide = allouerZeroArene(areneCourante, analyseur.nbNoeuds, sizeof(unsigned char));
+	premieres = allouerZeroArene(areneCourante, analyseur.nbNoeuds, sizeof(ListePositions));
+	dernieres = allouerZeroArene(areneCourante, analyseur.nbNoeuds, sizeof(ListePositions));
+	premierIntervalle = allouerArene(areneCourante, sizeof(int)*(nbPositions + 2));
+	intervalles = allouerArene(areneCourante, 2*128*(size_t)nbPositions + 1);
+	nbIntervalles = 0;
+	premierIntervalle[1] = 0;
+	nbPositions = 0;
+
+	//les fils ayant des indices plus petits que leur père, un parcours par indice croissant calcule les fils en premier
+	//chaque liste d'un fils est consommée par son unique père
+	for (i = 0; i < analyseur.nbNoeuds; i++)
+	{
+		if(!atteint[i])
+		{
+			continue;
+		}
+		noeud = &analyseur.noeuds[i];
+		g = noeud->gauche;
+		d = noeud->droite;
+		switch(noeud->type)
+		{
+			case NOEUD_ENSEMBLE:
+				nbPositions++;
+				ajouterPosition(&premieres[i], nbPositions);
+				ajouterPosition(&dernieres[i], nbPositions);
+				//découpage de l'ensemble en intervalles de caractères consécutifs
+				for (c = 0; c < 256; c++)
+				{
+					if(noeud->ensemble[c/8] & (1 << (c%8)))
+					{
+						if(c == 0 || !(noeud->ensemble[(c-1)/8] & (1 << ((c-1)%8))))
+						{
+							intervalles[2*nbIntervalles] = c;
+							nbIntervalles++;
+						}
+						intervalles[2*nbIntervalles-1] = c;
+					}
+				}
+				premierIntervalle[nbPositions+1] = nbIntervalles;
+				break;
+			case NOEUD_VIDE:
+				vide[i] = 1;
+				break;
+			case NOEUD_UNION:
+				vide[i] = vide[g] || vide[d];
+				fusionnerPositions(&premieres[g], &premieres[d], &premieres[i]);
+				fusionnerPositions(&dernieres[g], &dernieres[d], &dernieres[i]);
+				break;
+			case NOEUD_CONCATENATION:
+				relierPositions(automate, &dernieres[g], &premieres[d], premierIntervalle, intervalles);
+				vide[i] = vide[g] && vide[d];
+				if(vide[g])
+				{
+					fusionnerPositions(&premieres[g], &premieres[d], &premieres[i]);
+				}
+				else
+				{
+					premieres[i] = premieres[g];
+					libererArene(areneCourante, premieres[d].elements);
+				}
+				if(vide[d])
+				{
+					fusionnerPositions(&dernieres[g], &dernieres[d], &dernieres[i]);
+				}
+				else
+				{
+					dernieres[i] = dernieres[d];
+					libererArene(areneCourante, dernieres[g].elements);
+				}
+				break;
+			case NOEUD_ETOILE:
+			case NOEUD_PLUS:
+			case NOEUD_OPTION:
+				if(noeud->type != NOEUD_OPTION)
+				{
+					relierPositions(automate, &dernieres[g], &premieres[g], premierIntervalle, intervalles);
+				}
+				vide[i] = noeud->type == NOEUD_PLUS ? vide[g] : 1;
+				premieres[i] = premieres[g];
+				dernieres[i] = dernieres[g];
+				break;
+		}
+	}
+
+	//l'état initial mène aux premières positions, les dernières positions sont finales ainsi que l'état initial si le mot vide est reconnu
+	etatInitial = 0;
+	initial.elements = &etatInitial;
+	initial.taille = 1;
+	initial.capacite = 1;
+	relierPositions(automate, &initial, &premieres[racine], premierIntervalle, intervalles);
+	automate->nbEtatsFinaux = dernieres[racine].taille + vide[racine];
+	automate->capaciteFinaux = automate->nbEtatsFinaux;
+	automate->final = reallouerArene(automate->arene, automate->final, sizeof(int)*automate->nbEtatsFinaux);
+	if(dernieres[racine].taille > 0)
+	{
+		memcpy(automate->final, dernieres[racine].elements, sizeof(int)*dernieres[racine].taille);
+	}
+	if(vide[racine])
+	{
+		automate->final[dernieres[racine].taille] = 0;
+	}
+
+	libererArene(areneCourante, premieres[racine].elements);
+	libererArene(areneCourante, dernieres[racine].elements);
+	libererArene(areneCourante, premieres);
+	libererArene(areneCourante, dernieres);
+	libererArene(areneCourante, vide);
+	libererArene(areneCourante, atteint);
+	libererArene(areneCourante, premierIntervalle);
+	libererArene(areneCourante, intervalles);
+	libererArene(areneCourante, analyseur.noeuds);
+	return 1;
+}
+
+//agrandit un tableau d'entiers de l'arène fournie pour qu'il contienne au moins taille cases, en doublant sa capacité
+static int* agrandirTableauEntiers(Arene* arene, int* tableau, int* capacite, int taille)
+{
+	if(taille > *capacite)
+	{
+		*capacite = 2 * *capacite > taille ? 2 * *capacite : taille;
+		tableau = reallouerArene(arene, tableau, sizeof(int) * *capacite);
+	}
+	return tableau;
+}
+
+//alloue le tableau des motifs de l'automate si il n'en a pas encore, aucun état n'ayant de motif
+static void preparerMotifsAFND(AFND* automate)
+{
+	//compteur de boucle
+	int i;
+
+	if(automate->motif != NULL)
+	{
+		return;
+	}
+	automate->motif = allouerArene(automate->arene, sizeof(int)*(automate->capaciteEtats + 1));
+	for (i = 0; i < automate->capaciteEtats; i++)
+	{
+		automate->motif[i] = -1;
+	}
+}
+
+void attribuerMotifAFND(AFND* automate, int motif)
+{
+	//compteur de boucle
+	int i;
+
+	preparerMotifsAFND(automate);
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		automate->motif[automate->final[i]] = motif;
+	}
+}
+
+//agrandit les tableaux indexés par état pour qu'ils contiennent au moins taille états, en doublant leur capacité
+//les cases ajoutées sont des états sans aucune transition
+static void agrandirEtatsAFND(AFND* automate, int taille)
+{
+	//capacité demandée, partagée par tous les tableaux indexés par état
+	int capacite;
+
+	//compteur de boucle
+	int i;
+
+	if(taille <= automate->capaciteEtats)
+	{
+		return;
+	}
+	capacite = automate->capaciteEtats;
+	automate->nbTransitions = agrandirTableauEntiers(automate->arene, automate->nbTransitions, &capacite, taille);
+	capacite = automate->capaciteEtats;
+	automate->capaciteTransitions = agrandirTableauEntiers(automate->arene, automate->capaciteTransitions, &capacite, taille);
+	capacite = automate->capaciteEtats;
+	automate->nbEpsilons = agrandirTableauEntiers(automate->arene, automate->nbEpsilons, &capacite, taille);
+	capacite = automate->capaciteEtats;
+	automate->capaciteEpsilons = agrandirTableauEntiers(automate->arene, automate->capaciteEpsilons, &capacite, taille);
+	automate->transition = reallouerArene(automate->arene, automate->transition, sizeof(Arc*)*capacite);
+	automate->epsilon = reallouerArene(automate->arene, automate->epsilon, sizeof(int*)*capacite);
+	if(automate->motif != NULL)
+	{
+		automate->motif = reallouerArene(automate->arene, automate->motif, sizeof(int)*capacite);
+	}
+	for (i = automate->capaciteEtats; i < capacite; i++)
+	{
+		if(automate->motif != NULL)
+		{
+			automate->motif[i] = -1;
+		}
+		automate->nbTransitions[i] = 0;
+		automate->capaciteTransitions[i] = 0;
+		automate->transition[i] = NULL;
+		automate->nbEpsilons[i] = 0;
+		automate->capaciteEpsilons[i] = 0;
+		automate->epsilon[i] = NULL;
+	}
+	automate->capaciteEtats = capacite;
+}
+
+//ajoute un état sans transition à l'automate et retourne son numéro
+static int ajouterEtatAFND(AFND* automate)
+{
+	agrandirEtatsAFND(automate, automate->nbEtats + 1);
+	automate->nbEtats++;
+	return automate->nbEtats - 1;
+}
+
+//déplace les états de automate2 à la suite de ceux de automate1 en décalant les arrivées de leurs transitions
+//les tableaux de transitions sont repris tels quels, les tableaux indexés par état de automate2 sont libérés
+//retourne le décalage appliqué aux états de automate2
+static int absorberEtatsAFND(AFND* automate1, AFND* automate2)
+{
+	//décalage des états de automate2
+	int decalage;
+
+	//compteurs de boucle
+	int i,k;
+
+	decalage = automate1->nbEtats;
+	if(automate2->motif != NULL)
+	{
+		preparerMotifsAFND(automate1);
+	}
+	agrandirEtatsAFND(automate1, automate1->nbEtats + automate2->nbEtats);
+
+	for (i = 0; i < automate2->nbEtats; i++)
+	{
+		automate1->nbTransitions[decalage + i] = automate2->nbTransitions[i];
+		automate1->capaciteTransitions[decalage + i] = automate2->capaciteTransitions[i];
+		automate1->transition[decalage + i] = automate2->transition[i];
+		for (k = 0; k < automate2->nbTransitions[i]; k++)
+		{
+			automate1->transition[decalage + i][k].arrivee += decalage;
+		}
+		automate1->nbEpsilons[decalage + i] = automate2->nbEpsilons[i];
+		automate1->capaciteEpsilons[decalage + i] = automate2->capaciteEpsilons[i];
+		automate1->epsilon[decalage + i] = automate2->epsilon[i];
+		for (k = 0; k < automate2->nbEpsilons[i]; k++)
+		{
+			automate1->epsilon[decalage + i][k] += decalage;
+		}
+		if(automate1->motif != NULL)
+		{
+			automate1->motif[decalage + i] = automate2->motif != NULL ? automate2->motif[i] : -1;
+		}
+	}
+	automate1->nbEtats += automate2->nbEtats;
+
+	libererArene(automate2->arene, automate2->nbTransitions);
+	libererArene(automate2->arene, automate2->capaciteTransitions);
+	libererArene(automate2->arene, automate2->transition);
+	libererArene(automate2->arene, automate2->nbEpsilons);
+	libererArene(automate2->arene, automate2->capaciteEpsilons);
+	libererArene(automate2->arene, automate2->epsilon);
+	libererArene(automate2->arene, automate2->motif);
+	return decalage;
+}
+
+void unionAFNDEnPlace(AFND* automate1, AFND* automate2)
+{
+	//décalage des états de automate2
+	int decalage;
+
+	//compteur de boucle
+	int i;
+
+	decalage = absorberEtatsAFND(automate1, automate2);
+
+	//les états initiaux et finaux de automate2 s'ajoutent à ceux de automate1
+	automate1->initial = agrandirTableauEntiers(automate1->arene, automate1->initial, &automate1->capaciteInitiaux, automate1->nbEtatsInitiaux + automate2->nbEtatsInitiaux);
+	for (i = 0; i < automate2->nbEtatsInitiaux; i++)
+	{
+		automate1->initial[automate1->nbEtatsInitiaux++] = automate2->initial[i] + decalage;
+	}
+	automate1->final = agrandirTableauEntiers(automate1->arene, automate1->final, &automate1->capaciteFinaux, automate1->nbEtatsFinaux + automate2->nbEtatsFinaux);
+	for (i = 0; i < automate2->nbEtatsFinaux; i++)
+	{
+		automate1->final[automate1->nbEtatsFinaux++] = automate2->final[i] + decalage;
+	}
+
+	libererArene(automate2->arene, automate2->initial);
+	libererArene(automate2->arene, automate2->final);
+}
+
+//retourne le motif porté par tous les états finaux de l'automate, ou -1 s'il n'a pas de motifs ou si ses états finaux en portent plusieurs
+static int motifFinauxAFND(AFND* automate)
+{
+	//motif du premier état final
+	int motif;
+
+	//compteur de boucle
+	int i;
+
+	if(automate->motif == NULL || automate->nbEtatsFinaux == 0)
+	{
+		return -1;
+	}
+	motif = automate->motif[automate->final[0]];
+	for (i = 1; i < automate->nbEtatsFinaux; i++)
+	{
+		if(automate->motif[automate->final[i]] != motif)
+		{
+			return -1;
+		}
+	}
+	return motif;
+}
+
+void concatenationAFNDEnPlace(AFND* automate1, AFND* automate2)
+{
+	//décalage des états de automate2
+	int decalage;
+
+	//état de liaison entre les états finaux de automate1 et les états initiaux de automate2
+	int liaison;
+
+	//motif commun aux états finaux de automate1
+	int motif;
+
+	//compteur de boucle
+	int i;
+
+	motif = motifFinauxAFND(automate1);
+	decalage = absorberEtatsAFND(automate1, automate2);
+
+	//un seul état de liaison : le nombre de transitions ajoutées est la somme et non le produit des nombres d'états finaux et initiaux
+	//si automate2 reconnaît le mot vide, les états finaux de automate1 atteignent spontanément un de ses états finaux
+	liaison = ajouterEtatAFND(automate1);
+	for (i = 0; i < automate1->nbEtatsFinaux; i++)
+	{
+		ajouterEpsilonAFND(automate1, automate1->final[i], liaison);
+	}
+	for (i = 0; i < automate2->nbEtatsInitiaux; i++)
+	{
+		ajouterEpsilonAFND(automate1, liaison, automate2->initial[i] + decalage);
+	}
+
+	//les états finaux sont ceux de automate2, ceux qui n'ont pas de motif reprennent celui de automate1
+	automate1->nbEtatsFinaux = 0;
+	automate1->final = agrandirTableauEntiers(automate1->arene, automate1->final, &automate1->capaciteFinaux, automate2->nbEtatsFinaux);
+	for (i = 0; i < automate2->nbEtatsFinaux; i++)
+	{
+		automate1->final[automate1->nbEtatsFinaux++] = automate2->final[i] + decalage;
+		if(motif != -1 && automate1->motif[automate2->final[i] + decalage] == -1)
+		{
+			automate1->motif[automate2->final[i] + decalage] = motif;
+		}
+	}
+
+	libererArene(automate2->arene, automate2->initial);
+	libererArene(automate2->arene, automate2->final);
+}
+
+void fermetureIterativeDeKleeneEnPlace(AFND* automate)
+{
+	//nouvel état initial et final
+	int centre;
+
+	//motif commun aux anciens états finaux
+	int motif;
+
+	//nombre d'anciens états finaux qui le restent
+	int nbGardes;
+
+	//compteur de boucle
+	int i;
+
+	motif = motifFinauxAFND(automate);
+	centre = ajouterEtatAFND(automate);
+	if(automate->motif != NULL)
+	{
+		automate->motif[centre] = motif;
+	}
+	for (i = 0; i < automate->nbEtatsInitiaux; i++)
+	{
+		ajouterEpsilonAFND(automate, centre, automate->initial[i]);
+	}
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		ajouterEpsilonAFND(automate, automate->final[i], centre);
+	}
+
+	//le nouvel état reconnaît le mot vide et remplace les états initiaux et finaux, les combinaisons suivantes n'ont plus qu'un état à relier
+	//un ancien état final dont le motif diffère de celui du centre reste final, pour que les mots qui s'y terminent gardent leur motif
+	automate->initial = agrandirTableauEntiers(automate->arene, automate->initial, &automate->capaciteInitiaux, 1);
+	automate->initial[0] = centre;
+	automate->nbEtatsInitiaux = 1;
+	nbGardes = 0;
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		if(automate->motif != NULL && automate->motif[automate->final[i]] != -1 && automate->motif[automate->final[i]] != motif)
+		{
+			automate->final[nbGardes++] = automate->final[i];
+		}
+	}
+	automate->final = agrandirTableauEntiers(automate->arene, automate->final, &automate->capaciteFinaux, nbGardes + 1);
+	automate->final[nbGardes] = centre;
+	automate->nbEtatsFinaux = nbGardes + 1;
+}
+
+//remplit l'entête du fichier d'un automate compact, dont les positions découlent des tailles
+static void remplirEnteteAFDCompact(AFDCompact* compact, EnteteAFDCompact* entete)
+{
+	memset(entete, 0, sizeof(EnteteAFDCompact));
+	memcpy(entete->magie, "AUTOMATO", 8);
+	entete->version = VERSION_FICHIER_AFD;
+	entete->boutisme = 0x01020304;
+	entete->nbEtats = compact->nbEtats;
+	entete->largeur = compact->largeur;
+	entete->nbClasses = compact->nbClasses;
+	entete->initial = compact->initial;
+	entete->decalageClasses = sizeof(EnteteAFDCompact);
+	entete->decalageTransition = (entete->decalageClasses + 256 + 7) / 8 * 8;
+	entete->decalageDrapeaux = entete->decalageTransition + (uint64_t)compact->largeur*compact->nbClasses*compact->nbEtats;
+	entete->tailleTotale = entete->decalageDrapeaux + compact->nbEtats;
+}
+
+int enregistrerAFDCompact(AFDCompact* compact, const char* chemin)
+{
+	//entête du fichier
+	EnteteAFDCompact entete;
+
+	//fichier écrit
+	FILE* fichier;
+
+	//octets de remplissage avant la table de transitions
+	char zeros[8];
+
+	//booléen indiquant que toutes les écritures ont réussi
+	int ecrit;
+
+	remplirEnteteAFDCompact(compact, &entete);
+	memset(zeros, 0, sizeof(zeros));
+
+	fichier = fopen(chemin, "wb");
+	if(fichier == NULL)
+	{
+		return 0;
+	}
+	ecrit = fwrite(&entete, 1, sizeof(entete), fichier) == sizeof(entete)
+		&& fwrite(compact->classe, 1, 256, fichier) == 256
+		&& fwrite(zeros, 1, entete.decalageTransition - entete.decalageClasses - 256, fichier) == entete.decalageTransition - entete.decalageClasses - 256
+		&& fwrite(compact->transition, 1, entete.decalageDrapeaux - entete.decalageTransition, fichier) == entete.decalageDrapeaux - entete.decalageTransition
+		&& fwrite(compact->drapeaux, 1, compact->nbEtats, fichier) == (size_t)compact->nbEtats;
+	if(fclose(fichier) != 0)
+	{
+		ecrit = 0;
+	}
+	return ecrit;
+}
+
+int chargerAFDCompact(const char* chemin, AFDCompact* compact)
+{
+	//entête lue dans la projection
+	EnteteAFDCompact* entete;
+
+	//entête attendue pour les tailles lues, pour vérifier les positions
+	EnteteAFDCompact attendue;
+
+	//taille du fichier
+	struct stat informations;
+
+	//descripteur et projection du fichier
+	int descripteur;
+	char* projection;
+
+	descripteur = open(chemin, O_RDONLY);
+	if(descripteur < 0)
+	{
+		return 0;
+	}
+	if(fstat(descripteur, &informations) < 0 || (size_t)informations.st_size < sizeof(EnteteAFDCompact))
+	{
+		close(descripteur);
+		return 0;
+	}
+	projection = mmap(NULL, informations.st_size, PROT_READ, MAP_SHARED, descripteur, 0);
+	//la projection reste valide une fois le descripteur fermé
+	close(descripteur);
+	if(projection == MAP_FAILED)
+	{
+		return 0;
+	}
+
+	entete = (EnteteAFDCompact*)projection;
+	compact->nbEtats = entete->nbEtats;
+	compact->largeur = entete->largeur;
+	compact->nbClasses = entete->nbClasses;
+	compact->initial = entete->initial;
+	remplirEnteteAFDCompact(compact, &attendue);
+	if(memcmp(entete->magie, "AUTOMATO", 8) != 0 || entete->version != VERSION_FICHIER_AFD || entete->boutisme != 0x01020304
+		|| (entete->largeur != 1 && entete->largeur != 2 && entete->largeur != 4)
+		|| entete->nbClasses < 1 || entete->nbClasses > 256 || entete->initial >= entete->nbEtats
+		|| entete->decalageClasses != attendue.decalageClasses || entete->decalageTransition != attendue.decalageTransition
+		|| entete->decalageDrapeaux != attendue.decalageDrapeaux || entete->tailleTotale != attendue.tailleTotale
+		|| entete->tailleTotale != (uint64_t)informations.st_size)
+	{
+		munmap(projection, informations.st_size);
+		return 0;
+	}
+
+	//les classes sont recopiées dans la structure, la table et les drapeaux restent dans la projection
+	memcpy(compact->classe, projection + entete->decalageClasses, 256);
+	compact->transition = projection + entete->decalageTransition;
+	compact->drapeaux = (unsigned char*)projection + entete->decalageDrapeaux;
+	compact->projection = projection;
+	compact->tailleProjection = informations.st_size;
+	accelererAFDCompact(compact);
+	return 1;
+}
+
+//écrit le contenu d'un tableau C constant, seize valeurs par ligne
+static void genererValeursC(FILE* sortie, int* valeurs, int nombre)
+{
+	int i;
+
+	for (i = 0; i < nombre; i++)
+	{
+		fprintf(sortie, "%s%d%s", i % 16 == 0 ? "\t" : "", valeurs[i], i + 1 == nombre ? "\n" : (i % 16 == 15 ? ",\n" : ", "));
+	}
+}
+
+void genererCodeC(AFD* automate, const char* nom, int forme, FILE* sortie)
+{
+	//valeurs d'un tableau constant à écrire
+	int* valeurs;
+
+	//estFinal[e] vaut 1 si l'état e est final
+	int* estFinal;
+
+	//drapeaux de chaque état, pour rejeter dès qu'un état mort est atteint et accepter dès qu'un état universel l'est
+	unsigned char* drapeaux;
+
+	//destination de chaque classe depuis l'état courant, -1 si la transition est absente ou mène à un état mort
+	int destination[256];
+
+	//destination la plus fréquente depuis l'état courant, traitée par le cas default
+	int frequente,occurrences,compte;
+
+	//nombre de lignes de la table, une ligne de rejet s'ajoute aux états quand une transition est absente
+	int nbLignes;
+
+	//largeur en octets des numéros d'états de la table
+	int largeur;
+
+	//vaut 1 si la table des classes est lue par le code produit
+	int classesUtiles;
+
+	//compteurs de boucle
+	int e,k,l;
+
+	estFinal = calloc(automate->nbEtats, sizeof(int));
+	for (e = 0; e < automate->nbEtatsFinaux; e++)
+	{
+		estFinal[automate->final[e]] = 1;
+	}
+	drapeaux = malloc(automate->nbEtats + 1);
+	analyserEtatsAFD(automate, drapeaux);
+
+	fprintf(sortie, "//produit par genererCodeC : %d états, %d classes de caractères\n", automate->nbEtats, automate->nbClasses);
+	fprintf(sortie, "#include <stddef.h>\n#include <stdint.h>\n\n");
+
+	//sous forme goto, un automate dont chaque état mène au même état quelle que soit la classe n'a pas besoin de la table des classes
+	classesUtiles = forme == GENERATION_TABLE;
+	for (e = 0; e < automate->nbEtats && !classesUtiles; e++)
+	{
+		if(drapeaux[e] & (ETAT_MORT | ETAT_UNIVERSEL))
+		{
+			continue;
+		}
+		for (k = 0; k < automate->nbClasses; k++)
+		{
+			destination[k] = automate->transition[k][e] == -1 || (drapeaux[automate->transition[k][e]] & ETAT_MORT) ? -1 : automate->transition[k][e];
+			classesUtiles |= destination[k] != destination[0];
+		}
+	}
+
+	valeurs = malloc(sizeof(int) * ((automate->nbEtats + 1)*automate->nbClasses > 256 ? (automate->nbEtats + 1)*automate->nbClasses : 256));
+	if(classesUtiles)
+	{
+		for (k = 0; k < 256; k++)
+		{
+			valeurs[k] = automate->classe[k];
+		}
+		fprintf(sortie, "static const unsigned char %s_classe[256] =\n{\n", nom);
+		genererValeursC(sortie, valeurs, 256);
+		fprintf(sortie, "};\n\n");
+	}
+
+	if(forme == GENERATION_TABLE)
+	{
+		//une transition absente ou vers un état mort mène à la ligne de rejet, numérotée nbEtats, où la lecture s'arrête
+		nbLignes = automate->nbEtats;
+		for (e = 0; e < automate->nbEtats; e++)
+		{
+			for (k = 0; k < automate->nbClasses; k++)
+			{
+				valeurs[e*automate->nbClasses + k] = automate->transition[k][e];
+				if(automate->transition[k][e] == -1 || (drapeaux[automate->transition[k][e]] & ETAT_MORT))
+				{
+					valeurs[e*automate->nbClasses + k] = automate->nbEtats;
+					nbLignes = automate->nbEtats + 1;
+				}
+			}
+		}
+		for (k = 0; k < automate->nbClasses; k++)
+		{
+			valeurs[automate->nbEtats*automate->nbClasses + k] = automate->nbEtats;
+		}
+		largeur = nbLignes <= 256 ? 8 : (nbLignes <= 65536 ? 16 : 32);
+		fprintf(sortie, "static const uint%d_t %s_transition[%d] =\n{\n", largeur, nom, nbLignes*automate->nbClasses);
+		genererValeursC(sortie, valeurs, nbLignes*automate->nbClasses);
+		fprintf(sortie, "};\n\n");
+		fprintf(sortie, "static const unsigned char %s_final[%d] =\n{\n", nom, automate->nbEtats);
+		genererValeursC(sortie, estFinal, automate->nbEtats);
+		fprintf(sortie, "};\n\n");
+
+		fprintf(sortie, "int %s(const char* mot, size_t longueurMot)\n{\n", nom);
+		fprintf(sortie, "\tsize_t etat = %d;\n\tsize_t i;\n\n", automate->initial);
+		fprintf(sortie, "\tfor (i = 0; i < longueurMot; i++)\n\t{\n");
+		fprintf(sortie, "\t\tetat = %s_transition[etat*%d + %s_classe[(unsigned char)mot[i]]];\n", nom, automate->nbClasses, nom);
+		if(nbLignes > automate->nbEtats)
+		{
+			fprintf(sortie, "\t\tif(etat == %d)\n\t\t{\n\t\t\treturn 0;\n\t\t}\n", automate->nbEtats);
+		}
+		fprintf(sortie, "\t}\n\treturn %s_final[etat];\n}\n", nom);
+	}
+	else
+	{
+		fprintf(sortie, "int %s(const char* mot, size_t longueurMot)\n{\n", nom);
+		fprintf(sortie, "\tconst unsigned char* c = (const unsigned char*)mot;\n");
+		fprintf(sortie, "\tconst unsigned char* fin = c + longueurMot;\n\n");
+		fprintf(sortie, "\tgoto e%d;\n", automate->initial);
+		for (e = 0; e < automate->nbEtats; e++)
+		{
+			//aucune transition ne mène à un état mort, seul l'état initial peut en être un
+			if((drapeaux[e] & ETAT_MORT) && e != automate->initial)
+			{
+				continue;
+			}
+			//la suite du mot ne change plus rien depuis un état mort ou universel
+			fprintf(sortie, "e%d:\n", e);
+			if(drapeaux[e] & (ETAT_MORT | ETAT_UNIVERSEL))
+			{
+				fprintf(sortie, "\treturn %d;\n", (drapeaux[e] & ETAT_UNIVERSEL) != 0);
+				continue;
+			}
+
+			for (k = 0; k < automate->nbClasses; k++)
+			{
+				destination[k] = automate->transition[k][e] == -1 || (drapeaux[automate->transition[k][e]] & ETAT_MORT) ? -1 : automate->transition[k][e];
+			}
+
+			//la destination la plus fréquente devient le cas default du switch
+			frequente = destination[0];
+			occurrences = 0;
+			for (k = 0; k < automate->nbClasses; k++)
+			{
+				compte = 0;
+				for (l = 0; l < automate->nbClasses; l++)
+				{
+					compte += destination[l] == destination[k];
+				}
+				if(compte > occurrences)
+				{
+					occurrences = compte;
+					frequente = destination[k];
+				}
+			}
+
+			fprintf(sortie, "\tif(c == fin)\n\t{\n\t\treturn %d;\n\t}\n", estFinal[e]);
+			if(occurrences == automate->nbClasses)
+			{
+				if(frequente == -1)
+				{
+					fprintf(sortie, "\treturn 0;\n");
+				}
+				else
+				{
+					fprintf(sortie, "\tc++;\n\tgoto e%d;\n", frequente);
+				}
+				continue;
+			}
+			fprintf(sortie, "\tswitch(%s_classe[*c++])\n\t{\n", nom);
+			//les classes menant au même état partagent leur goto, celles sans transition rejettent le mot
+			for (k = 0; k < automate->nbClasses; k++)
+			{
+				if(destination[k] == frequente || destination[k] == -2)
+				{
+					continue;
+				}
+				fprintf(sortie, "\t\tcase %d:", k);
+				for (l = k + 1; l < automate->nbClasses; l++)
+				{
+					if(destination[l] == destination[k])
+					{
+						fprintf(sortie, " case %d:", l);
+						destination[l] = -2;
+					}
+				}
+				if(destination[k] == -1)
+				{
+					fprintf(sortie, "\n\t\t\treturn 0;\n");
+				}
+				else
+				{
+					fprintf(sortie, "\n\t\t\tgoto e%d;\n", destination[k]);
+				}
+			}
+			if(frequente == -1)
+			{
+				fprintf(sortie, "\t\tdefault:\n\t\t\treturn 0;\n\t}\n");
+			}
+			else
+			{
+				fprintf(sortie, "\t\tdefault:\n\t\t\tgoto e%d;\n\t}\n", frequente);
+			}
+		}
+		fprintf(sortie, "}\n");
+	}
+
+	free(valeurs);
+	free(drapeaux);
+	free(estFinal);
+}
+
+//construit l'automate produit des deux automates pour l'opération fournie puis le minimise
+//une composante dont la transition est absente a rejeté le mot et vaut -1, comme l'état atteint par parcourirAFD
+static void produitAFD(AFD* automate1, AFD* automate2, int operation, AFD* resultat)
+{
+	//table des couples d'états découverts, le couple (p,q) est rangé comme l'ensemble {p,q} dans cet ordre, p ou q pouvant valoir -1
+	TableEnsembles table;
+
+	//couple courant et couple successeur
+	int couple[2];
+	int suivant[2];
+
+	//numéro de l'état produit atteint
+	int numero;
+
+	//booléen indiquant si le couple vient d'être ajouté à la table
+	int ajoute;
+
+	//classe produit de chaque couple de classes, -1 si le couple n'est la classe d'aucun caractère
+	int* classeCouple;
+
+	//classes de caractères de l'automate produit et nombre de classes
+	unsigned char classe[256];
+	int nbClasses;
+
+	//premier caractère de chaque classe produit
+	int representant[256];
+
+	//estFinal1[e] et estFinal2[e] valent 1 si l'état e du premier ou du second automate est final
+	unsigned char* estFinal1;
+	unsigned char* estFinal2;
+
+	//valent 1 si l'état courant de l'automate produit, de sa première ou de sa seconde composante est final
+	int final;
+	int final1;
+	int final2;
+
+	//tableau des transitions de l'automate produit rangé état par état, comme dans determiniser
+	int* transitionProduit;
+	int capaciteTransitionProduit;
+
+	//états finaux de l'automate produit
+	int* finalProduit;
+	int nbEtatsFinauxProduit;
+	int capaciteFinalProduit;
+
+	//automate produit avant minimisation
+	AFD produit;
+
+	//compteurs de boucle
+	int i,j,courant;
+
+	//les classes produit raffinent les classes des deux automates
+	classeCouple = allouerArene(areneCourante, sizeof(int)*automate1->nbClasses*automate2->nbClasses);
+	for (i = 0; i < automate1->nbClasses*automate2->nbClasses; i++)
+	{
+		classeCouple[i] = -1;
+	}
+	nbClasses = 0;
+	for (i = 0; i < 256; i++)
+	{
+		j = automate1->classe[i]*automate2->nbClasses + automate2->classe[i];
+		if(classeCouple[j] == -1)
+		{
+			classeCouple[j] = nbClasses;
+			representant[nbClasses] = i;
+			nbClasses++;
+		}
+		classe[i] = classeCouple[j];
+	}
+
+	estFinal1 = allouerZeroArene(areneCourante, automate1->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate1->nbEtatsFinaux; i++)
+	{
+		estFinal1[automate1->final[i]] = 1;
+	}
+	estFinal2 = allouerZeroArene(areneCourante, automate2->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate2->nbEtatsFinaux; i++)
+	{
+		estFinal2[automate2->final[i]] = 1;
+	}
+
+	capaciteTransitionProduit = 16;
+	transitionProduit = allouerArene(areneCourante, sizeof(int)*capaciteTransitionProduit*nbClasses);
+	nbEtatsFinauxProduit = 0;
+	capaciteFinalProduit = 16;
+	finalProduit = allouerArene(areneCourante, sizeof(int)*capaciteFinalProduit);
+
+	initialiserTableEnsembles(&table, areneCourante);
+	couple[0] = automate1->initial;
+	couple[1] = automate2->initial;
+	chercherOuAjouterEnsemble(&table, couple, 2, &ajoute);
+
+	//parcours en largeur des couples accessibles, numérotés dans leur ordre de découverte
+	for (courant = 0; courant < table.nbEnsembles; courant++)
+	{
+		if(courant == capaciteTransitionProduit)
+		{
+			capaciteTransitionProduit *= 2;
+			transitionProduit = reallouerArene(areneCourante, transitionProduit, sizeof(int)*capaciteTransitionProduit*nbClasses);
+		}
+		couple[0] = table.elements[table.debut[courant]];
+		couple[1] = table.elements[table.debut[courant] + 1];
+
+		final1 = couple[0] != -1 && estFinal1[couple[0]];
+		final2 = couple[1] != -1 && estFinal2[couple[1]];
+		if(operation == PRODUIT_INTERSECTION)
+		{
+			final = final1 && final2;
+		}
+		else if(operation == PRODUIT_DIFFERENCE)
+		{
+			final = final1 && !final2;
+		}
+		else if(operation == PRODUIT_DIFFERENCE_SYMETRIQUE)
+		{
+			final = final1 != final2;
+		}
+		else
+		{
+			final = final1 || final2;
+		}
+		if(final)
+		{
+			if(nbEtatsFinauxProduit == capaciteFinalProduit)
+			{
+				capaciteFinalProduit *= 2;
+				finalProduit = reallouerArene(areneCourante, finalProduit, sizeof(int)*capaciteFinalProduit);
+			}
+			finalProduit[nbEtatsFinauxProduit] = courant;
+			nbEtatsFinauxProduit++;
+		}
+
+		for (i = 0; i < nbClasses; i++)
+		{
+			suivant[0] = couple[0] == -1 ? -1 : automate1->transition[automate1->classe[representant[i]]][couple[0]];
+			suivant[1] = couple[1] == -1 ? -1 : automate2->transition[automate2->classe[representant[i]]][couple[1]];
+
+			//un couple depuis lequel aucun mot ne peut plus être reconnu n'est pas construit, la transition reste absente
+			if((suivant[0] == -1 && suivant[1] == -1) || (suivant[0] == -1 && (operation == PRODUIT_INTERSECTION || operation == PRODUIT_DIFFERENCE))
+				|| (suivant[1] == -1 && operation == PRODUIT_INTERSECTION))
+			{
+				transitionProduit[courant*nbClasses + i] = -1;
+				continue;
+			}
+			numero = chercherOuAjouterEnsemble(&table, suivant, 2, &ajoute);
+			transitionProduit[courant*nbClasses + i] = numero;
+		}
+	}
+
+	construireAFDViergeClasses(&produit, table.nbEnsembles, nbEtatsFinauxProduit, nbClasses, classe);
+	produit.initial = 0;
+	for (i = 0; i < nbEtatsFinauxProduit; i++)
+	{
+		produit.final[i] = finalProduit[i];
+	}
+	for (i = 0; i < nbClasses; i++)
+	{
+		for (j = 0; j < produit.nbEtats; j++)
+		{
+			produit.transition[i][j] = transitionProduit[j*nbClasses + i];
+		}
+	}
+	minimiserHopcroft(&produit, resultat);
+	compresserAFD(resultat);
+
+	desallouerAFD(&produit);
+	libererArene(areneCourante, transitionProduit);
+	libererArene(areneCourante, finalProduit);
+	libererArene(areneCourante, estFinal1);
+	libererArene(areneCourante, estFinal2);
+	libererArene(areneCourante, classeCouple);
+	libererTableEnsembles(&table);
+}
+
+void intersectionAFD(AFD* automate1, AFD* automate2, AFD* intersection)
+{
+	produitAFD(automate1, automate2, PRODUIT_INTERSECTION, intersection);
+}
+
+void differenceAFD(AFD* automate1, AFD* automate2, AFD* difference)
+{
+	produitAFD(automate1, automate2, PRODUIT_DIFFERENCE, difference);
+}
+
+void differenceSymetriqueAFD(AFD* automate1, AFD* automate2, AFD* differenceSymetrique)
+{
+	produitAFD(automate1, automate2, PRODUIT_DIFFERENCE_SYMETRIQUE, differenceSymetrique);
+}
+
+void unionAFD(AFD* automate1, AFD* automate2, AFD* automate_union)
+{
+	produitAFD(automate1, automate2, PRODUIT_UNION, automate_union);
+}
+
+void complementAFD(AFD* automate, AFD* complement)
+{
+	//automate complété par un état puits dont les états finaux sont inversés, avant minimisation
+	AFD inverse;
+
+	//numéro de l'état puits, qui reçoit les transitions absentes
+	int puits;
+
+	//estFinal[e] vaut 1 si l'état e est final dans l'automate fourni
+	unsigned char* estFinal;
+
+	//compteurs de boucle
+	int i,j;
+
+	estFinal = allouerZeroArene(areneCourante, automate->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		estFinal[automate->final[i]] = 1;
+	}
+
+	//une transition absente rejette le mot : elle mène au puits, qui boucle sur lui-même et devient final après inversion
+	puits = automate->nbEtats;
+	construireAFDViergeClasses(&inverse, automate->nbEtats + 1, automate->nbEtats + 1 - automate->nbEtatsFinaux, automate->nbClasses, automate->classe);
+	inverse.initial = automate->initial;
+	j = 0;
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		if(!estFinal[i])
+		{
+			inverse.final[j] = i;
+			j++;
+		}
+	}
+	inverse.final[j] = puits;
+	for (i = 0; i < automate->nbClasses; i++)
+	{
+		for (j = 0; j < automate->nbEtats; j++)
+		{
+			inverse.transition[i][j] = automate->transition[i][j] == -1 ? puits : automate->transition[i][j];
+		}
+		inverse.transition[i][puits] = puits;
+	}
+	minimiserHopcroft(&inverse, complement);
+	compresserAFD(complement);
+
+	desallouerAFD(&inverse);
+	libererArene(areneCourante, estFinal);
+}
+
+void supprimerEpsilonsAFND(AFND* automate, AFND* sansEpsilon)
+{
+	//fermeture de l'état courant : lui-même et les états qu'il atteint spontanément
+	int* ensemble;
+	int taille;
+
+	//marques utilisées par fermerEpsilon, une valeur de tampon par état parcouru
+	int* marque;
+	int tampon;
+
+	//estFinal[e] vaut 1 si l'état e est final
+	unsigned char* estFinal;
+
+	//vaut 1 si la fermeture de l'état courant contient un état final
+	int final;
+
+	//transition recopiée
+	Arc* arc;
+
+	//compteurs de boucle
+	int i,j,k;
+
+	ensemble = allouerArene(areneCourante, sizeof(int)*(automate->nbEtats + 1));
+	marque = allouerZeroArene(areneCourante, automate->nbEtats, sizeof(int));
+	tampon = 0;
+	estFinal = allouerZeroArene(areneCourante, automate->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		estFinal[automate->final[i]] = 1;
+	}
+
+	//les états finaux sont ajoutés au fur et à mesure
+	construireAFNDVierge(sansEpsilon, automate->nbEtats, automate->nbEtatsInitiaux, 0);
+	memcpy(sansEpsilon->initial, automate->initial, sizeof(int)*automate->nbEtatsInitiaux);
+
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		tampon++;
+		marque[i] = tampon;
+		ensemble[0] = i;
+		taille = fermerEpsilon(automate, ensemble, 1, marque, tampon);
+
+		//l'état reprend les transitions de toute sa fermeture et devient final si elle contient un état final
+		final = 0;
+		for (j = 0; j < taille; j++)
+		{
+			for (k = 0; k < automate->nbTransitions[ensemble[j]]; k++)
+			{
+				arc = &automate->transition[ensemble[j]][k];
+				ajouterTransitionAFND(sansEpsilon, i, arc->arrivee, arc->debut, arc->fin);
+			}
+			final |= estFinal[ensemble[j]];
+		}
+		if(final)
+		{
+			sansEpsilon->final = agrandirTableauEntiers(sansEpsilon->arene, sansEpsilon->final, &sansEpsilon->capaciteFinaux, sansEpsilon->nbEtatsFinaux + 1);
+			sansEpsilon->final[sansEpsilon->nbEtatsFinaux] = i;
+			sansEpsilon->nbEtatsFinaux++;
+		}
+	}
+
+	libererArene(areneCourante, ensemble);
+	libererArene(areneCourante, marque);
+	libererArene(areneCourante, estFinal);
+}
+
+void determiniserMotifs(AFND* nonDeter, AFDMotifs* deter)
+{
+	//table des ensembles d'états non déterministes composant chaque état déterministe
+	TableEnsembles table;
+
+	//estFinal[i] vaut 1 si l'état i de la version non déterministe est final
+	unsigned char* estFinal;
+
+	//nombre de motifs rangés et nombre de cases allouées
+	int nbMotifs;
+	int capaciteMotifs;
+
+	//début des motifs de l'état courant, position d'écriture lors de l'élimination des doublons et motif examiné
+	int debut;
+	int ecriture;
+	int motif;
+
+	//compteurs de boucle
+	int i,j;
+
+	determiniserTable(nonDeter, &deter->automate, &table);
+
+	estFinal = allouerZeroArene(areneCourante, nonDeter->nbEtats, sizeof(unsigned char));
+	for (i = 0; i < nonDeter->nbEtatsFinaux; i++)
+	{
+		estFinal[nonDeter->final[i]] = 1;
+	}
+
+	//les motifs d'un état déterministe sont ceux de ses composants finaux, triés et sans doublon
+	deter->debutMotifs = allouerArene(deter->automate.arene, sizeof(int)*(deter->automate.nbEtats + 1));
+	capaciteMotifs = 16;
+	deter->motifs = allouerArene(deter->automate.arene, sizeof(int)*capaciteMotifs);
+	nbMotifs = 0;
+	for (i = 0; i < table.nbEnsembles; i++)
+	{
+		debut = nbMotifs;
+		deter->debutMotifs[i] = debut;
+		for (j = table.debut[i]; j < table.debut[i+1]; j++)
+		{
+			if(!estFinal[table.elements[j]])
+			{
+				continue;
+			}
+			//un automate sans motifs reconnaît le seul motif 0
+			motif = nonDeter->motif != NULL ? nonDeter->motif[table.elements[j]] : 0;
+			if(motif >= 0)
+			{
+				deter->motifs = agrandirTableauEntiers(deter->automate.arene, deter->motifs, &capaciteMotifs, nbMotifs + 1);
+				deter->motifs[nbMotifs] = motif;
+				nbMotifs++;
+			}
+		}
+		qsort(&deter->motifs[debut], nbMotifs - debut, sizeof(int), comparerEntiers);
+		ecriture = debut;
+		for (j = debut; j < nbMotifs; j++)
+		{
+			if(ecriture == debut || deter->motifs[j] != deter->motifs[ecriture - 1])
+			{
+				deter->motifs[ecriture] = deter->motifs[j];
+				ecriture++;
+			}
+		}
+		nbMotifs = ecriture;
+	}
+	deter->debutMotifs[table.nbEnsembles] = nbMotifs;
+
+	libererArene(areneCourante, estFinal);
+	libererTableEnsembles(&table);
+}
+
+void minimiserMotifs(AFDMotifs* automate, AFDMotifs* minimal)
+{
+	//table des étiquettes : l'étiquette d'un état est le numéro de l'ensemble formé de sa finalité suivie de ses motifs
+	TableEnsembles table;
+
+	//étiquette de chaque état
+	int* etiquette;
+
+	//clé de l'état courant
+	int* cle;
+
+	//estFinal[i] vaut 1 si l'état i est final
+	unsigned char* estFinal;
+
+	//état minimal de chaque état
+	int* etatMinimal;
+
+	//premier état rencontré de chaque état minimal, dont il reprend les motifs
+	int* representant;
+
+	//booléen indiquant si la clé vient d'être ajoutée à la table
+	int ajoute;
+
+	//nombre de motifs d'un état
+	int nbMotifs;
+
+	//compteurs de boucle
+	int i,m;
+
+	estFinal = allouerZeroArene(areneCourante, automate->automate.nbEtats, sizeof(unsigned char));
+	for (i = 0; i < automate->automate.nbEtatsFinaux; i++)
+	{
+		estFinal[automate->automate.final[i]] = 1;
+	}
+
+	//deux états dont les finalités ou les ensembles de motifs diffèrent partent de blocs différents et ne sont jamais confondus
+	initialiserTableEnsembles(&table, areneCourante);
+	etiquette = allouerArene(areneCourante, sizeof(int)*(automate->automate.nbEtats + 1));
+	cle = allouerArene(areneCourante, sizeof(int)*(automate->debutMotifs[automate->automate.nbEtats] + 1));
+	for (i = 0; i < automate->automate.nbEtats; i++)
+	{
+		nbMotifs = automate->debutMotifs[i+1] - automate->debutMotifs[i];
+		cle[0] = estFinal[i];
+		memcpy(&cle[1], &automate->motifs[automate->debutMotifs[i]], sizeof(int)*nbMotifs);
+		etiquette[i] = chercherOuAjouterEnsemble(&table, cle, nbMotifs + 1, &ajoute);
+	}
+
+	etatMinimal = allouerArene(areneCourante, sizeof(int)*(automate->automate.nbEtats + 1));
+	minimiserHopcroftEtiquettes(&automate->automate, etiquette, table.nbEnsembles, &minimal->automate, etatMinimal);
+
+	//tous les états d'un état minimal ont les mêmes motifs, on reprend ceux du premier
+	representant = allouerArene(areneCourante, sizeof(int)*(minimal->automate.nbEtats + 1));
+	for (m = 0; m < minimal->automate.nbEtats; m++)
+	{
+		representant[m] = -1;
+	}
+	for (i = 0; i < automate->automate.nbEtats; i++)
+	{
+		//un état mort n'a pas d'état minimal
+		if(etatMinimal[i] != -1 && representant[etatMinimal[i]] == -1)
+		{
+			representant[etatMinimal[i]] = i;
+		}
+	}
+	minimal->debutMotifs = allouerArene(minimal->automate.arene, sizeof(int)*(minimal->automate.nbEtats + 1));
+	minimal->debutMotifs[0] = 0;
+	for (m = 0; m < minimal->automate.nbEtats; m++)
+	{
+		i = representant[m];
+		minimal->debutMotifs[m+1] = minimal->debutMotifs[m] + automate->debutMotifs[i+1] - automate->debutMotifs[i];
+	}
+	minimal->motifs = allouerArene(minimal->automate.arene, sizeof(int)*(minimal->debutMotifs[minimal->automate.nbEtats] + 1));
+	for (m = 0; m < minimal->automate.nbEtats; m++)
+	{
+		i = representant[m];
+		memcpy(&minimal->motifs[minimal->debutMotifs[m]], &automate->motifs[automate->debutMotifs[i]], sizeof(int)*(minimal->debutMotifs[m+1] - minimal->debutMotifs[m]));
+	}
+
+	libererArene(areneCourante, representant);
+	libererArene(areneCourante, etatMinimal);
+	libererArene(areneCourante, cle);
+	libererArene(areneCourante, etiquette);
+	libererTableEnsembles(&table);
+	libererArene(areneCourante, estFinal);
+}
+
+void desallouerAFDMotifs(AFDMotifs* automate)
+{
+	//la mémoire d'un automate construit dans une arène n'est rendue qu'avec l'arène
+	if(automate->automate.arene != NULL)
+	{
+		return;
+	}
+	desallouerAFD(&automate->automate);
+	libererArene(automate->automate.arene, automate->debutMotifs);
+	libererArene(automate->automate.arene, automate->motifs);
+}
+
+int motifsReconnus(char* mot, int longueurMot, AFDMotifs* automate, int** motifs)
+{
+	//état atteint à la fin du mot
+	int etat;
+
+	etat = parcourirAFD(mot, longueurMot, &automate->automate);
+	if(etat == -1)
+	{
+		*motifs = automate->motifs;
+		return 0;
+	}
+	*motifs = &automate->motifs[automate->debutMotifs[etat]];
+	return automate->debutMotifs[etat+1] - automate->debutMotifs[etat];
+}
+
+//cache de compilation partagé par tout le processus, préparé au premier appel de compilerAFNDCache qui ne fournit pas de cache
+static CacheCompilation cacheProcessus;
+static pthread_once_t preparationCacheProcessus = PTHREAD_ONCE_INIT;
+
+//prépare le cache partagé par tout le processus, appelée une seule fois par pthread_once
+static void preparerCacheProcessus(void)
+{
+	initialiserCacheCompilation(&cacheProcessus, TAILLE_CACHE_COMPILATION);
+}
+
+void initialiserCacheCompilation(CacheCompilation* cache, size_t memoireMax)
+{
+	pthread_mutex_init(&cache->verrou, NULL);
+	cache->nbAlveoles = 64;
+	cache->alveoles = calloc(cache->nbAlveoles, sizeof(EntreeCache*));
+	cache->nbEntrees = 0;
+	cache->plusRecente = NULL;
+	cache->plusAncienne = NULL;
+	cache->memoire = 0;
+	cache->memoireMax = memoireMax ? memoireMax : TAILLE_CACHE_COMPILATION;
+	cache->nbSucces = 0;
+	cache->nbEchecs = 0;
+}
+
+//libère une entrée déjà retirée du cache
+static void libererEntreeCache(EntreeCache* entree)
+{
+	desallouerAFD(&entree->minimal);
+	free(entree->cle);
+	free(entree);
+}
+
+void detruireCacheCompilation(CacheCompilation* cache)
+{
+	EntreeCache* entree;
+	EntreeCache* suivante;
+
+	for (entree = cache->plusRecente; entree != NULL; entree = suivante)
+	{
+		suivante = entree->plusAncienne;
+		libererEntreeCache(entree);
+	}
+	free(cache->alveoles);
+	pthread_mutex_destroy(&cache->verrou);
+}
+
+//met à plat la structure de l'automate non déterministe dans un tableau alloué par malloc et retourne sa taille
+//nombre d'états, puis pour chaque état ses transitions et ses transitions spontanées, puis les états initiaux et finaux
+//deux automates de même description ont le même automate minimal, les motifs sont ignorés comme par determiniser
+static int mettreAPlatAFND(AFND* automate, int** cle)
+{
+	int taille;
+	int n;
+	int i,j;
+
+	taille = 3 + automate->nbEtatsInitiaux + automate->nbEtatsFinaux;
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		taille += 2 + 2*automate->nbTransitions[i] + automate->nbEpsilons[i];
+	}
+
+	*cle = malloc(sizeof(int)*taille);
+	n = 0;
+	(*cle)[n++] = automate->nbEtats;
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		(*cle)[n++] = automate->nbTransitions[i];
+		for (j = 0; j < automate->nbTransitions[i]; j++)
+		{
+			(*cle)[n++] = automate->transition[i][j].arrivee;
+			(*cle)[n++] = automate->transition[i][j].debut << 8 | automate->transition[i][j].fin;
+		}
+		(*cle)[n++] = automate->nbEpsilons[i];
+		for (j = 0; j < automate->nbEpsilons[i]; j++)
+		{
+			(*cle)[n++] = automate->epsilon[i][j];
+		}
+	}
+	(*cle)[n++] = automate->nbEtatsInitiaux;
+	for (i = 0; i < automate->nbEtatsInitiaux; i++)
+	{
+		(*cle)[n++] = automate->initial[i];
+	}
+	(*cle)[n++] = automate->nbEtatsFinaux;
+	for (i = 0; i < automate->nbEtatsFinaux; i++)
+	{
+		(*cle)[n++] = automate->final[i];
+	}
+	return n;
+}
+
+//construit une copie de l'automate déterministe dans l'arène courante
+static void copierAFD(AFD* automate, AFD* copie)
+{
+	//compteur de boucle
+	int i;
+
+	construireAFDViergeClasses(copie, automate->nbEtats, automate->nbEtatsFinaux, automate->nbClasses, automate->classe);
+	copie->initial = automate->initial;
+	memcpy(copie->final, automate->final, sizeof(int)*automate->nbEtatsFinaux);
+	for (i = 0; i < automate->nbClasses; i++)
+	{
+		memcpy(copie->transition[i], automate->transition[i], sizeof(int)*automate->nbEtats);
+	}
+}
+
+//retire l'entrée de la liste d'utilisation du cache
+static void detacherEntreeCache(CacheCompilation* cache, EntreeCache* entree)
+{
+	if(entree->plusRecente != NULL)
+	{
+		entree->plusRecente->plusAncienne = entree->plusAncienne;
+	}
+	else
+	{
+		cache->plusRecente = entree->plusAncienne;
+	}
+	if(entree->plusAncienne != NULL)
+	{
+		entree->plusAncienne->plusRecente = entree->plusRecente;
+	}
+	else
+	{
+		cache->plusAncienne = entree->plusRecente;
+	}
+}
+
+//place l'entrée en tête de la liste d'utilisation du cache
+static void attacherEntreeCache(CacheCompilation* cache, EntreeCache* entree)
+{
+	entree->plusRecente = NULL;
+	entree->plusAncienne = cache->plusRecente;
+	if(cache->plusRecente != NULL)
+	{
+		cache->plusRecente->plusRecente = entree;
+	}
+	else
+	{
+		cache->plusAncienne = entree;
+	}
+	cache->plusRecente = entree;
+}
 
+//retourne l'entrée de même description que celle fournie, NULL si le cache n'en a pas
+static EntreeCache* chercherEntreeCache(CacheCompilation* cache, int* cle, int tailleCle, unsigned long empreinte)
+{
+	EntreeCache* entree;
 
-	//on commence par remplir le tableau de classes 1 donc le suivant doit être le 2
-	nextClasse = 2;
+	for (entree = cache->alveoles[empreinte & (cache->nbAlveoles - 1)]; entree != NULL; entree = entree->suivante)
+	{
+		if(entree->empreinte == empreinte && entree->tailleCle == tailleCle && memcmp(entree->cle, cle, sizeof(int)*tailleCle) == 0)
+		{
+			return entree;
+		}
+	}
+	return NULL;
+}
+
+//retire l'entrée la moins récemment utilisée du cache et la libère
+static void evincerEntreeCache(CacheCompilation* cache)
+{
+	EntreeCache* entree;
+	EntreeCache** lien;
+
+	entree = cache->plusAncienne;
+	for (lien = &cache->alveoles[entree->empreinte & (cache->nbAlveoles - 1)]; *lien != entree; lien = &(*lien)->suivante)
+	{
+	}
+	*lien = entree->suivante;
+	detacherEntreeCache(cache, entree);
+	cache->memoire -= entree->taille;
+	cache->nbEntrees--;
+	libererEntreeCache(entree);
+}
+
+//range une nouvelle entrée dans la table de hachage du cache, doublée quand elle a autant d'entrées que d'alvéoles
+static void insererEntreeCache(CacheCompilation* cache, EntreeCache* entree)
+{
+	EntreeCache** alveoles;
+	EntreeCache* courante;
+	EntreeCache* suivante;
+	int i;
+
+	if(cache->nbEntrees >= cache->nbAlveoles)
+	{
+		alveoles = calloc(cache->nbAlveoles*2, sizeof(EntreeCache*));
+		for (i = 0; i < cache->nbAlveoles; i++)
+		{
+			for (courante = cache->alveoles[i]; courante != NULL; courante = suivante)
+			{
+				suivante = courante->suivante;
+				courante->suivante = alveoles[courante->empreinte & (cache->nbAlveoles*2 - 1)];
+				alveoles[courante->empreinte & (cache->nbAlveoles*2 - 1)] = courante;
+			}
+		}
+		free(cache->alveoles);
+		cache->alveoles = alveoles;
+		cache->nbAlveoles *= 2;
+	}
+	entree->suivante = cache->alveoles[entree->empreinte & (cache->nbAlveoles - 1)];
+	cache->alveoles[entree->empreinte & (cache->nbAlveoles - 1)] = entree;
+	attacherEntreeCache(cache, entree);
+	cache->memoire += entree->taille;
+	cache->nbEntrees++;
+}
+
+void compilerAFNDCache(AFND* automate, CacheCompilation* cache, AFD* minimal)
+{
+	//description de l'automate et son empreinte
+	int* cle;
+	int tailleCle;
+	unsigned long empreinte;
+
+	//entrée trouvée ou ajoutée
+	EntreeCache* entree;
+
+	//entrée de même description ajoutée par un autre thread pendant la compilation
+	EntreeCache* concurrente;
+
+	//automate déterministe intermédiaire
+	AFD deter;
+
+	//arène de l'appelant, mise de côté pendant la compilation
+	Arene* precedente;
+
+	if(cache == NULL)
+	{
+		pthread_once(&preparationCacheProcessus, preparerCacheProcessus);
+		cache = &cacheProcessus;
+	}
+
+	tailleCle = mettreAPlatAFND(automate, &cle);
+	empreinte = empreinteEnsemble(cle, tailleCle);
+
+	pthread_mutex_lock(&cache->verrou);
+	entree = chercherEntreeCache(cache, cle, tailleCle, empreinte);
+	if(entree != NULL)
+	{
+		detacherEntreeCache(cache, entree);
+		attacherEntreeCache(cache, entree);
+		cache->nbSucces++;
+		//la recopie se fait sous le verrou pour que l'entrée ne soit pas évincée entre temps
+		copierAFD(&entree->minimal, minimal);
+		pthread_mutex_unlock(&cache->verrou);
+		free(cle);
+		return;
+	}
+	cache->nbEchecs++;
+	pthread_mutex_unlock(&cache->verrou);
+
+	//la compilation se fait hors du verrou, avec malloc pour que l'entrée survive à l'arène de l'appelant
+	entree = malloc(sizeof(EntreeCache));
+	entree->cle = cle;
+	entree->tailleCle = tailleCle;
+	entree->empreinte = empreinte;
+	utiliserArene(NULL, &precedente);
+	determiniser(automate, &deter);
+	minimiserHopcroft(&deter, &entree->minimal);
+	desallouerAFD(&deter);
+	utiliserArene(precedente, NULL);
+	copierAFD(&entree->minimal, minimal);
+	entree->taille = sizeof(EntreeCache) + sizeof(int)*(size_t)tailleCle
+		+ sizeof(int)*((size_t)entree->minimal.nbClasses*entree->minimal.nbEtats + entree->minimal.nbEtatsFinaux);
+
+	pthread_mutex_lock(&cache->verrou);
+	//un automate plus grand que tout le cache n'y est pas gardé, pas plus qu'un automate compilé entre temps par un autre thread
+	concurrente = chercherEntreeCache(cache, cle, tailleCle, empreinte);
+	if(entree->taille > cache->memoireMax || concurrente != NULL)
+	{
+		pthread_mutex_unlock(&cache->verrou);
+		libererEntreeCache(entree);
+		return;
+	}
+	while(cache->memoire + entree->taille > cache->memoireMax)
+	{
+		evincerEntreeCache(cache);
+	}
+	insererEntreeCache(cache, entree);
+	pthread_mutex_unlock(&cache->verrou);
+}
+
+//retourne l'indice de la première transition de l'état du dictionnaire dont le caractère est supérieur ou égal à c
+static int positionTransitionDictionnaire(DictionnaireAFD* dictionnaire, int etat, unsigned char c)
+{
+	//bornes de la recherche dichotomique
+	int bas,haut,milieu;
+
+	bas = 0;
+	haut = dictionnaire->nbTransitions[etat];
+	while(bas < haut)
+	{
+		milieu = (bas + haut) / 2;
+		if(dictionnaire->transition[etat][milieu].debut < c)
+		{
+			bas = milieu + 1;
+		}
+		else
+		{
+			haut = milieu;
+		}
+	}
+	return bas;
+}
+
+//retourne l'état atteint depuis l'état fourni par le caractère c, -1 si il n'existe pas de transition
+static int destinationDictionnaire(DictionnaireAFD* dictionnaire, int etat, unsigned char c)
+{
+	int position;
+
+	position = positionTransitionDictionnaire(dictionnaire, etat, c);
+	if(position < dictionnaire->nbTransitions[etat] && dictionnaire->transition[etat][position].debut == c)
+	{
+		return dictionnaire->transition[etat][position].arrivee;
+	}
+	return -1;
+}
+
+//fait mener la transition de l'état fourni par le caractère c à arrivee, en l'ajoutant si elle n'existe pas encore
+static void poserTransitionDictionnaire(DictionnaireAFD* dictionnaire, int etat, unsigned char c, int arrivee)
+{
+	int position;
+
+	position = positionTransitionDictionnaire(dictionnaire, etat, c);
+	if(position < dictionnaire->nbTransitions[etat] && dictionnaire->transition[etat][position].debut == c)
+	{
+		dictionnaire->degre[dictionnaire->transition[etat][position].arrivee]--;
+	}
+	else
+	{
+		if(dictionnaire->nbTransitions[etat] == dictionnaire->capaciteTransitions[etat])
+		{
+			dictionnaire->capaciteTransitions[etat] = dictionnaire->capaciteTransitions[etat] ? dictionnaire->capaciteTransitions[etat]*2 : 2;
+			dictionnaire->transition[etat] = realloc(dictionnaire->transition[etat], sizeof(Arc)*dictionnaire->capaciteTransitions[etat]);
+		}
+		memmove(&dictionnaire->transition[etat][position + 1], &dictionnaire->transition[etat][position],
+			sizeof(Arc)*(dictionnaire->nbTransitions[etat] - position));
+		dictionnaire->nbTransitions[etat]++;
+		dictionnaire->transition[etat][position].debut = c;
+		dictionnaire->transition[etat][position].fin = c;
+	}
+	dictionnaire->transition[etat][position].arrivee = arrivee;
+	dictionnaire->degre[arrivee]++;
+}
+
+//retire la transition de l'état fourni par le caractère c, qui doit exister
+static void retirerTransitionDictionnaire(DictionnaireAFD* dictionnaire, int etat, unsigned char c)
+{
+	int position;
+
+	position = positionTransitionDictionnaire(dictionnaire, etat, c);
+	dictionnaire->degre[dictionnaire->transition[etat][position].arrivee]--;
+	dictionnaire->nbTransitions[etat]--;
+	memmove(&dictionnaire->transition[etat][position], &dictionnaire->transition[etat][position + 1],
+		sizeof(Arc)*(dictionnaire->nbTransitions[etat] - position));
+}
+
+//retourne un nouvel état non final et sans transition, pris parmi les états libres ou ajouté après les autres
+static int nouvelEtatDictionnaire(DictionnaireAFD* dictionnaire)
+{
+	int etat;
+
+	if(dictionnaire->libre != -1)
+	{
+		etat = dictionnaire->libre;
+		dictionnaire->libre = dictionnaire->suivant[etat];
+		dictionnaire->nbLibres--;
+	}
+	else
+	{
+		//les tableaux indexés par état doublent quand ils sont pleins, comme dans les combinateurs en place
+		if(dictionnaire->nbEtats == dictionnaire->capaciteEtats)
+		{
+			dictionnaire->capaciteEtats = dictionnaire->capaciteEtats ? dictionnaire->capaciteEtats*2 : 16;
+			dictionnaire->transition = realloc(dictionnaire->transition, sizeof(Arc*)*dictionnaire->capaciteEtats);
+			dictionnaire->nbTransitions = realloc(dictionnaire->nbTransitions, sizeof(int)*dictionnaire->capaciteEtats);
+			dictionnaire->capaciteTransitions = realloc(dictionnaire->capaciteTransitions, sizeof(int)*dictionnaire->capaciteEtats);
+			dictionnaire->final = realloc(dictionnaire->final, dictionnaire->capaciteEtats);
+			dictionnaire->degre = realloc(dictionnaire->degre, sizeof(int)*dictionnaire->capaciteEtats);
+			dictionnaire->enregistre = realloc(dictionnaire->enregistre, dictionnaire->capaciteEtats);
+			dictionnaire->suivant = realloc(dictionnaire->suivant, sizeof(int)*dictionnaire->capaciteEtats);
+		}
+		etat = dictionnaire->nbEtats;
+		dictionnaire->nbEtats++;
+		dictionnaire->transition[etat] = NULL;
+		dictionnaire->capaciteTransitions[etat] = 0;
+	}
+	dictionnaire->nbTransitions[etat] = 0;
+	dictionnaire->final[etat] = 0;
+	dictionnaire->degre[etat] = 0;
+	dictionnaire->enregistre[etat] = 0;
+	return etat;
+}
+
+//rend un état qui n'est plus atteint par aucune transition et qui n'est pas dans le registre, ses transitions sont retirées
+static void libererEtatDictionnaire(DictionnaireAFD* dictionnaire, int etat)
+{
+	int i;
+
+	for (i = 0; i < dictionnaire->nbTransitions[etat]; i++)
+	{
+		dictionnaire->degre[dictionnaire->transition[etat][i].arrivee]--;
+	}
+	dictionnaire->nbTransitions[etat] = 0;
+	dictionnaire->suivant[etat] = dictionnaire->libre;
+	dictionnaire->libre = etat;
+	dictionnaire->nbLibres++;
+}
+
+//calcule l'empreinte d'un état du dictionnaire à partir de sa finalité et de ses transitions
+static unsigned long empreinteEtatDictionnaire(DictionnaireAFD* dictionnaire, int etat)
+{
+	unsigned long h;
+	int i;
+
+	h = (14695981039346656037UL ^ dictionnaire->final[etat]) * 1099511628211UL;
+	for (i = 0; i < dictionnaire->nbTransitions[etat]; i++)
+	{
+		h = (h ^ dictionnaire->transition[etat][i].debut) * 1099511628211UL;
+		h = (h ^ (unsigned int)dictionnaire->transition[etat][i].arrivee) * 1099511628211UL;
+	}
+	return h;
+}
+
+//retourne vrai si les deux états ont la même finalité et les mêmes transitions
+static int memeEtatDictionnaire(DictionnaireAFD* dictionnaire, int etat1, int etat2)
+{
+	int i;
+
+	if(dictionnaire->final[etat1] != dictionnaire->final[etat2] || dictionnaire->nbTransitions[etat1] != dictionnaire->nbTransitions[etat2])
+	{
+		return 0;
+	}
+	for (i = 0; i < dictionnaire->nbTransitions[etat1]; i++)
+	{
+		if(dictionnaire->transition[etat1][i].debut != dictionnaire->transition[etat2][i].debut
+			|| dictionnaire->transition[etat1][i].arrivee != dictionnaire->transition[etat2][i].arrivee)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+//retourne l'état du registre de même description que l'état fourni, -1 si le registre n'en a pas
+static int chercherRegistreDictionnaire(DictionnaireAFD* dictionnaire, int etat)
+{
+	int courant;
+
+	courant = dictionnaire->alveoles[empreinteEtatDictionnaire(dictionnaire, etat) & (dictionnaire->nbAlveoles - 1)];
+	while(courant != -1 && !memeEtatDictionnaire(dictionnaire, courant, etat))
+	{
+		courant = dictionnaire->suivant[courant];
+	}
+	return courant;
+}
+
+//range l'état dans le registre, dont les alvéoles doublent quand il a autant d'états qu'elles
+static void enregistrerEtatDictionnaire(DictionnaireAFD* dictionnaire, int etat)
+{
+	//ancienne table d'alvéoles et son nombre d'alvéoles
+	int* alveoles;
+	int nbAlveoles;
+
+	//état déplacé et état suivant de la même alvéole
+	int courant,suivant;
+
+	//alvéole de l'état
+	unsigned long alveole;
+
+	int i;
+
+	if(dictionnaire->nbEnregistres >= dictionnaire->nbAlveoles)
+	{
+		alveoles = dictionnaire->alveoles;
+		nbAlveoles = dictionnaire->nbAlveoles;
+		dictionnaire->nbAlveoles *= 2;
+		dictionnaire->alveoles = malloc(sizeof(int)*dictionnaire->nbAlveoles);
+		for (i = 0; i < dictionnaire->nbAlveoles; i++)
+		{
+			dictionnaire->alveoles[i] = -1;
+		}
+		for (i = 0; i < nbAlveoles; i++)
+		{
+			for (courant = alveoles[i]; courant != -1; courant = suivant)
+			{
+				suivant = dictionnaire->suivant[courant];
+				alveole = empreinteEtatDictionnaire(dictionnaire, courant) & (dictionnaire->nbAlveoles - 1);
+				dictionnaire->suivant[courant] = dictionnaire->alveoles[alveole];
+				dictionnaire->alveoles[alveole] = courant;
+			}
+		}
+		free(alveoles);
+	}
+	alveole = empreinteEtatDictionnaire(dictionnaire, etat) & (dictionnaire->nbAlveoles - 1);
+	dictionnaire->suivant[etat] = dictionnaire->alveoles[alveole];
+	dictionnaire->alveoles[alveole] = etat;
+	dictionnaire->enregistre[etat] = 1;
+	dictionnaire->nbEnregistres++;
+}
+
+//retire l'état du registre avant qu'il ne soit modifié, sa description changeant son alvéole
+static void desenregistrerEtatDictionnaire(DictionnaireAFD* dictionnaire, int etat)
+{
+	int* lien;
+
+	if(!dictionnaire->enregistre[etat])
+	{
+		return;
+	}
+	lien = &dictionnaire->alveoles[empreinteEtatDictionnaire(dictionnaire, etat) & (dictionnaire->nbAlveoles - 1)];
+	while(*lien != etat)
+	{
+		lien = &dictionnaire->suivant[*lien];
+	}
+	*lien = dictionnaire->suivant[etat];
+	dictionnaire->enregistre[etat] = 0;
+	dictionnaire->nbEnregistres--;
+}
+
+//suit le mot depuis l'état initial en rangeant dans chemin les états traversés, chemin[0] étant l'état initial
+//retourne la longueur du plus long préfixe du mot lu avant qu'une transition ne manque
+static int suivreMotDictionnaire(DictionnaireAFD* dictionnaire, char* mot, int longueurMot, int* chemin)
+{
+	int i;
+
+	chemin[0] = dictionnaire->initial;
+	for (i = 0; i < longueurMot; i++)
+	{
+		chemin[i+1] = destinationDictionnaire(dictionnaire, chemin[i], mot[i]);
+		if(chemin[i+1] == -1)
+		{
+			break;
+		}
+	}
+	return i;
+}
+
+//prépare la modification des états chemin[1] à chemin[longueur] : ils sont retirés du registre, et à partir du premier
+//état atteint par plusieurs transitions, chacun est remplacé sur le chemin par une copie pour ne pas changer les autres mots
+static void detacherCheminDictionnaire(DictionnaireAFD* dictionnaire, char* mot, int longueur, int* chemin)
+{
+	//copie de l'état courant
+	int copie;
+
+	int i,j;
+
+	for (i = 1; i <= longueur && dictionnaire->degre[chemin[i]] == 1; i++)
+	{
+		desenregistrerEtatDictionnaire(dictionnaire, chemin[i]);
+	}
+	//la copie d'un état mène aux mêmes états que lui, le suivant sur le chemin est donc lui aussi atteint plusieurs fois
+	for (; i <= longueur; i++)
+	{
+		copie = nouvelEtatDictionnaire(dictionnaire);
+		dictionnaire->final[copie] = dictionnaire->final[chemin[i]];
+		for (j = 0; j < dictionnaire->nbTransitions[chemin[i]]; j++)
+		{
+			poserTransitionDictionnaire(dictionnaire, copie, dictionnaire->transition[chemin[i]][j].debut, dictionnaire->transition[chemin[i]][j].arrivee);
+		}
+		poserTransitionDictionnaire(dictionnaire, chemin[i-1], mot[i-1], copie);
+		chemin[i] = copie;
+	}
+}
+
+//remonte le chemin depuis chemin[longueur] : chaque état est confondu avec l'état du registre de même description si il en existe un,
+//et rangé dans le registre sinon ; ses successeurs étant déjà uniques, l'automate redevient minimal
+static void remplacerOuEnregistrerDictionnaire(DictionnaireAFD* dictionnaire, char* mot, int longueur, int* chemin)
+{
+	//état équivalent trouvé dans le registre
+	int equivalent;
+
+	int i;
+
+	for (i = longueur; i >= 1; i--)
+	{
+		equivalent = chercherRegistreDictionnaire(dictionnaire, chemin[i]);
+		if(equivalent == -1)
+		{
+			enregistrerEtatDictionnaire(dictionnaire, chemin[i]);
+		}
+		else
+		{
+			poserTransitionDictionnaire(dictionnaire, chemin[i-1], mot[i-1], equivalent);
+			libererEtatDictionnaire(dictionnaire, chemin[i]);
+		}
+	}
+}
+
+void construireDictionnaireVide(DictionnaireAFD* dictionnaire)
+{
+	int i;
+
+	dictionnaire->nbEtats = 0;
+	dictionnaire->capaciteEtats = 0;
+	dictionnaire->transition = NULL;
+	dictionnaire->nbTransitions = NULL;
+	dictionnaire->capaciteTransitions = NULL;
+	dictionnaire->final = NULL;
+	dictionnaire->degre = NULL;
+	dictionnaire->enregistre = NULL;
+	dictionnaire->suivant = NULL;
+	dictionnaire->libre = -1;
+	dictionnaire->nbLibres = 0;
+	dictionnaire->nbMots = 0;
+	dictionnaire->nbAlveoles = 64;
+	dictionnaire->nbEnregistres = 0;
+	dictionnaire->alveoles = malloc(sizeof(int)*dictionnaire->nbAlveoles);
+	for (i = 0; i < dictionnaire->nbAlveoles; i++)
+	{
+		dictionnaire->alveoles[i] = -1;
+	}
+	dictionnaire->initial = nouvelEtatDictionnaire(dictionnaire);
+}
+
+int construireDictionnaireAFD(AFD* automate, DictionnaireAFD* dictionnaire)
+{
+	//état du dictionnaire de chaque état de l'automate, -1 pour un état d'où aucun mot n'est reconnu
+	int* numero;
+
+	//nombre de mots reconnus depuis chaque état de l'automate
+	long* nbMots;
+
+	//0 pour un état pas encore atteint, 1 pour un état sur la pile, 2 pour un état traité
+	unsigned char* couleur;
+
+	//drapeaux de chaque état, seuls les états qui ne sont pas marqués ETAT_MORT sont parcourus
+	unsigned char* drapeaux;
+
+	//pile du parcours en profondeur et prochain caractère à examiner de chaque état
+	int* pile;
+	int* prochain;
+	int nbPile;
+
+	//état courant, destination de la transition courante, état du dictionnaire construit et état équivalent du registre
+	int etat,dest,nouveau,equivalent;
+
+	int c,i;
+
+	numero = malloc(sizeof(int)*(automate->nbEtats + 1));
+	for (i = 0; i < automate->nbEtats; i++)
+	{
+		numero[i] = -1;
+	}
+	nbMots = calloc(automate->nbEtats + 1, sizeof(long));
+	couleur = calloc(automate->nbEtats + 1, sizeof(unsigned char));
+	pile = malloc(sizeof(int)*(automate->nbEtats + 1));
+	prochain = calloc(automate->nbEtats + 1, sizeof(int));
+	drapeaux = malloc(automate->nbEtats + 1);
+	analyserEtatsAFD(automate, drapeaux);
+
+	construireDictionnaireVide(dictionnaire);
+
+	//parcours en profondeur depuis l'état initial : chaque état est construit après ses successeurs,
+	//qui sont donc déjà uniques quand on le cherche dans le registre
+	//les états morts ne sont jamais empilés, un cycle entre eux ne rend pas le langage infini
+	nbPile = 1;
+	pile[0] = automate->initial;
+	couleur[automate->initial] = 1;
+	while(nbPile > 0)
+	{
+		etat = pile[nbPile - 1];
+		dest = -1;
+		while(prochain[etat] < 256 && dest == -1)
+		{
+			dest = automate->transition[automate->classe[prochain[etat]]][etat];
+			prochain[etat]++;
+			if(dest != -1 && (couleur[dest] == 2 || (drapeaux[dest] & ETAT_MORT)))
+			{
+				dest = -1;
+			}
+		}
+		if(dest != -1)
+		{
+			//un état vivant déjà sur la pile est atteint par un cycle : l'automate reconnaît une infinité de mots
+			if(couleur[dest] == 1)
+			{
+				desallouerDictionnaire(dictionnaire);
+				free(drapeaux);
+				free(prochain);
+				free(pile);
+				free(couleur);
+				free(nbMots);
+				free(numero);
+				return 0;
+			}
+			couleur[dest] = 1;
+			pile[nbPile] = dest;
+			nbPile++;
+			continue;
+		}
+
+		nbPile--;
+		couleur[etat] = 2;
+		nouveau = etat == automate->initial ? dictionnaire->initial : nouvelEtatDictionnaire(dictionnaire);
+		nbMots[etat] = estFinalAFD(automate, etat);
+		dictionnaire->final[nouveau] = nbMots[etat];
+		for (c = 0; c < 256; c++)
+		{
+			dest = automate->transition[automate->classe[c]][etat];
+			if(dest != -1 && numero[dest] != -1)
+			{
+				poserTransitionDictionnaire(dictionnaire, nouveau, c, numero[dest]);
+				nbMots[etat] += nbMots[dest];
+			}
+		}
+		numero[etat] = nouveau;
+		if(nouveau == dictionnaire->initial)
+		{
+			continue;
+		}
+		//un état d'où aucun mot n'est reconnu n'est pas gardé, la transition qui y mène reste absente
+		if(!dictionnaire->final[nouveau] && dictionnaire->nbTransitions[nouveau] == 0)
+		{
+			libererEtatDictionnaire(dictionnaire, nouveau);
+			numero[etat] = -1;
+			continue;
+		}
+		equivalent = chercherRegistreDictionnaire(dictionnaire, nouveau);
+		if(equivalent == -1)
+		{
+			enregistrerEtatDictionnaire(dictionnaire, nouveau);
+		}
+		else
+		{
+			libererEtatDictionnaire(dictionnaire, nouveau);
+			numero[etat] = equivalent;
+		}
+	}
+	dictionnaire->nbMots = nbMots[automate->initial];
+
+	free(drapeaux);
+	free(prochain);
+	free(pile);
+	free(couleur);
+	free(nbMots);
+	free(numero);
+	return 1;
+}
+
+void desallouerDictionnaire(DictionnaireAFD* dictionnaire)
+{
+	int i;
+
+	for (i = 0; i < dictionnaire->nbEtats; i++)
+	{
+		free(dictionnaire->transition[i]);
+	}
+	free(dictionnaire->transition);
+	free(dictionnaire->nbTransitions);
+	free(dictionnaire->capaciteTransitions);
+	free(dictionnaire->final);
+	free(dictionnaire->degre);
+	free(dictionnaire->enregistre);
+	free(dictionnaire->suivant);
+	free(dictionnaire->alveoles);
+}
+
+int ajouterMotDictionnaire(DictionnaireAFD* dictionnaire, char* mot, int longueurMot)
+{
+	//états traversés par le mot, chemin[i] étant atteint après i caractères
+	int* chemin;
+
+	//longueur du préfixe déjà présent dans l'automate
+	int prefixe;
+
+	int i;
+
+	chemin = malloc(sizeof(int)*(longueurMot + 1));
+	prefixe = suivreMotDictionnaire(dictionnaire, mot, longueurMot, chemin);
+	if(prefixe == longueurMot && dictionnaire->final[chemin[longueurMot]])
+	{
+		free(chemin);
+		return 0;
+	}
+
+	detacherCheminDictionnaire(dictionnaire, mot, prefixe, chemin);
+
+	//la fin du mot reçoit de nouveaux états, confondus ensuite avec ceux du registre
+	for (i = prefixe; i < longueurMot; i++)
+	{
+		chemin[i+1] = nouvelEtatDictionnaire(dictionnaire);
+		poserTransitionDictionnaire(dictionnaire, chemin[i], mot[i], chemin[i+1]);
+	}
+	dictionnaire->final[chemin[longueurMot]] = 1;
+
+	remplacerOuEnregistrerDictionnaire(dictionnaire, mot, longueurMot, chemin);
+	dictionnaire->nbMots++;
+	free(chemin);
+	return 1;
+}
+
+int retirerMotDictionnaire(DictionnaireAFD* dictionnaire, char* mot, int longueurMot)
+{
+	//états traversés par le mot, chemin[i] étant atteint après i caractères
+	int* chemin;
+
+	//longueur du chemin qui reste après le retrait des états devenus inutiles
+	int longueur;
 
-	//on initialise la variable d'arrêt à 0 pour la boucle de minimisation
-	arret = 0;
+	chemin = malloc(sizeof(int)*(longueurMot + 1));
+	if(suivreMotDictionnaire(dictionnaire, mot, longueurMot, chemin) < longueurMot || !dictionnaire->final[chemin[longueurMot]])
+	{
+		free(chemin);
+		return 0;
+	}
 
-	//on alloue une case par état de notre automate pour chaque caractère dans le tableau des transitions
-	for (i = 0; i < 256; i++)
+	detacherCheminDictionnaire(dictionnaire, mot, longueurMot, chemin);
+	dictionnaire->final[chemin[longueurMot]] = 0;
+
+	//les états de fin du chemin qui ne sont plus finaux et n'ont plus de transition ne mènent plus à aucun mot
+	longueur = longueurMot;
+	while(longueur > 0 && !dictionnaire->final[chemin[longueur]] && dictionnaire->nbTransitions[chemin[longueur]] == 0)
 	{
-		transitionClasse[i] = malloc(sizeof(int)*automate->nbEtats);
+		retirerTransitionDictionnaire(dictionnaire, chemin[longueur-1], mot[longueur-1]);
+		libererEtatDictionnaire(dictionnaire, chemin[longueur]);
+		longueur--;
 	}
-	
-	//pour chaque tableau de classes on alloue une case par état également (puisqu'on veut stocker une classe par état)
-	classe1 = malloc(sizeof(int)*automate->nbEtats);
-	classe2 = malloc(sizeof(int)*automate->nbEtats);
 
-	//si il n'y a pas d'état final ou si ils le sont tous on a une seule classe et tous les états vont dedans
-	//autrement on a deux classes : une pour les états finaux et une pour les autres
-	if(automate->nbEtatsFinaux == 0 || automate->nbEtatsFinaux == automate->nbEtats)
+	remplacerOuEnregistrerDictionnaire(dictionnaire, mot, longueur, chemin);
+	dictionnaire->nbMots--;
+	free(chemin);
+	return 1;
+}
+
+int est_reconnu_dictionnaire(char* mot, int longueurMot, DictionnaireAFD* dictionnaire)
+{
+	//état courant pendant l'exécution
+	int etatCourant;
+
+	//compteur de boucle
+	int i;
+
+	etatCourant = dictionnaire->initial;
+	for (i = 0; i < longueurMot; i++)
 	{
-		nbClasses1 = 1;
-		for (i = 0; i < automate->nbEtats; i++)
+		etatCourant = destinationDictionnaire(dictionnaire, etatCourant, mot[i]);
+		if(etatCourant == -1)
 		{
-			classe1[i] = 0;
+			return 0;
 		}
 	}
-	else
+	return dictionnaire->final[etatCourant];
+}
+
+void convertirDictionnaireAFD(DictionnaireAFD* dictionnaire, AFD* automate)
+{
+	//numéro dans l'automate de chaque état du dictionnaire, -1 tant qu'il n'est pas atteint
+	int* numero;
+
+	//états du dictionnaire dans l'ordre de leur numéro, qui sert de file au parcours en largeur
+	int* ordre;
+	int nbAtteints;
+
+	//utilise[c] vaut 1 si une transition porte le caractère c
+	unsigned char utilise[256];
+
+	//classe de chaque caractère, un caractère utilisé par sa propre classe et les autres par une classe commune
+	unsigned char classe[256];
+	int nbClasses;
+	int inutilise;
+
+	//état courant et destination de la transition courante
+	int etat,dest;
+
+	int c,i,j;
+
+	numero = malloc(sizeof(int)*(dictionnaire->nbEtats + 1));
+	ordre = malloc(sizeof(int)*(dictionnaire->nbEtats + 1));
+	for (i = 0; i < dictionnaire->nbEtats; i++)
 	{
-		nbClasses1 = 2;
-		for (i = 0; i < automate->nbEtats; i++)
+		numero[i] = -1;
+	}
+	memset(utilise, 0, sizeof(utilise));
+	numero[dictionnaire->initial] = 0;
+	ordre[0] = dictionnaire->initial;
+	nbAtteints = 1;
+	for (i = 0; i < nbAtteints; i++)
+	{
+		etat = ordre[i];
+		for (j = 0; j < dictionnaire->nbTransitions[etat]; j++)
 		{
-			final = 0;
-			for (j = 0; j < automate->nbEtatsFinaux; j++)
-			{
-				if (i == automate->final[j])
-				{
-					final = 1;
-				}
-			}
-			if (final == 1)
+			utilise[dictionnaire->transition[etat][j].debut] = 1;
+			dest = dictionnaire->transition[etat][j].arrivee;
+			if(numero[dest] == -1)
 			{
-				classe1[i] = 0;
-			}
-			else
-			{
-				classe1[i] = 1;
+				numero[dest] = nbAtteints;
+				ordre[nbAtteints] = dest;
+				nbAtteints++;
 			}
 		}
 	}
-	//les classes 2 sont initialisées plus tard
-	nbClasses2 = 0;
 
-	//tant que la condition d'arrêt n'est pas atteinte
-	while(arret == 0)
+	//les classes sont numérotées dans l'ordre de leur premier caractère, comme par calculerClassesAFND
+	nbClasses = 0;
+	inutilise = -1;
+	for (c = 0; c < 256; c++)
 	{
-		//si le prochain tableau à remplir est le 1
-		if(nextClasse == 1)
-		{
-			//pour chaque caractère i
-			for (i = 0; i < 256; i++)
-			{
-				//pour chaque état j
-				for (j = 0; j < automate->nbEtats; j++)
-				{
-					//si il n'y a pas de transition par i à partir de j
-					if(automate->transition[i][j] == -1)
-					{
-						//j ne transitionne vers aucune classe par i
-						transitionClasse[i][j] = -1;
-					}
-					else //si il y a une transition par i à partir de j
-					{
-						//on crée une transition vers la classe de la destination dans transitionClasse
-						transitionClasse[i][j] = classe2[automate->transition[i][j]];
-					}
-				}
-			}
-			//on initialise le nombre de classes à 0 car on rempli le tableau depuis rien
-			nbClasses1 = 0;
-			//pour chaque état i
-			for (i = 0; i < automate->nbEtats; i++)
-			{
-				//on initialise l'état de i au nombre d'états du tableau
-				//le plus bas possible étant 0
-				classe1[i] = nbClasses1;
-				//pour chaque état j traité avant i
-				for (j = 0; j < i; j++)
-				{
-					//on initialise le booléen identique à vrai
-					identique = 1;
-					//pour chaque caractère k
-					for (k = 0; k < 256; k++)
-					{
-						//si on ne transitionne pas vers la même classe depuis les états i et j pour le caractère k
-						if(transitionClasse[k][i] != transitionClasse[k][j])
-						{
-							//le booléen identique devient faux pour indiquer que les deux états ne sont pas équivalents au regard de leurs transitions
-							//ils ne peuvent donc pas appartenir à la même classe
-							identique = 0;
-						}
-					}
-					//si les états i et j sont identiques au regard de leurs transitions
-					if(identique == 1)
-					{
-						//on donne la classe de j à i
-						classe1[i] = classe1[j];
-					}
-				}
-				//si i a toujours la classe égale au nombre de classes qu'on lui a donné au début de l'itération
-				//celà implique qu'on n'a trouvé aucun j équivalent à i du point de vue de ses transitions
-				if(classe1[i] == nbClasses1){
-					//on incrémente juste le nombre de classes ce qui revient à créer une nouvelle classe pour i
-					nbClasses1++;
-				}
-			}
-			nextClasse = 2;
-		}
-		else // si le prochain tableau à remplir est le 1 on fait le même traitement en inversant les tableaux
-		{
-			//pour chaque caractère i
-			for (i = 0; i < 256; i++)
-			{
-				//pour chaque état j
-				for (j = 0; j < automate->nbEtats; j++)
-				{
-					//si il n'y a pas de transition depuis j par i
-					if(automate->transition[i][j] == -1)
-					{
-						//j ne transtionne vers aucune classe par i
-						transitionClasse[i][j] = -1;
-					}
-					else //si il y a une transtion depuis j par i
-					{
-						//j transitionne vers la classe de la destination de la transition depuis j par i
-						transitionClasse[i][j] = classe1[automate->transition[i][j]];
-					}
-				}
-			}
-			//on initialise le nombre de classes à 0 car on remplie le tableau depuis rien
-			nbClasses2 = 0;
-			//pour chaque état i
-			for (i = 0; i < automate->nbEtats; i++)
-			{
-				//on assigne le nombre de classes comme classe à l'état
-				//minimum 0
-				classe2[i] = nbClasses2;
-				//pour chaque état j traité avant i
-				for (j = 0; j < i; j++)
-				{
-					//on initialise le booléen identique à vrai
-					identique = 1;
-					//pour chaque caractère k
-					for (k = 0; k < 256; k++)
-					{
-						//si i et j ne transitionnent pas vers la même classe pour k
-						if(transitionClasse[k][i] != transitionClasse[k][j])
-						{
-							//le booléen passe à faux car i et j ne sont pas identiques au regard de leurs transitions
-							identique = 0;
-						}
-					}
-					//si i et j sont identiques au regard de leurs transition
-					if(identique == 1)
-					{
-						//on donne à i la classe de j
-						classe2[i] = classe2[j];
-					}
-				}
-				//si i a toujours la classe égale au nombre de classes qu'on lui a donné au début de l'itération
-				//celà implique qu'on n'a trouvé aucun j équivalent à i du point de vue de ses transitions
-				if(classe2[i] == nbClasses2){
-					//on incrémente juste le nombre de classes ce qui revient à créer une nouvelle classe pour i
-					nbClasses2++;
-				}
-			}
-			//le prochain tableau à traiter est le 1
-			nextClasse = 1;
-		}
-		//ici on vérifie si la condition d'arrêt est remplie
-		if(nbClasses1 != nbClasses2)
+		if(utilise[c])
 		{
-			arret = 0;
+			classe[c] = nbClasses;
+			nbClasses++;
 		}
 		else
 		{
-			identique = 1;
-			for (i = 0; i < automate->nbEtats; i++)
-			{
-				if(classe1[i] != classe2[i])
-				{
-					identique = 0;
-				}
-			}
-			if (identique == 1)
+			if(inutilise == -1)
 			{
-				arret = 1;
+				inutilise = nbClasses;
+				nbClasses++;
 			}
+			classe[c] = inutilise;
 		}
 	}
 
-	//selon le dernier tableau de classes rempli on initialise et on complète l'automate minimal avec l'un ou l'autre de nos tableaux
-	if(nextClasse == 2)
+	j = 0;
+	for (i = 0; i < nbAtteints; i++)
 	{
-		construireAFDVierge(minimal,nbClasses1,0);
-		minimal->initial = classe1[automate->initial];
-		for(i = 0; i < automate->nbEtats; i++)
-		{
-			for(j = 0; j < automate->nbEtatsFinaux; j++)
-			{
-				if(automate->final[j] == i)
-				{
-					dejaAjoute = 0;
-					for(k = 0; k < minimal->nbEtatsFinaux; k++)
-					{
-						if(minimal->final[k] == classe1[i])
-						{
-							dejaAjoute = 1;
-						}
-					}
-					if(!dejaAjoute)
-					{
-						minimal->nbEtatsFinaux++;
-						minimal->final = realloc(minimal->final, sizeof(int)*minimal->nbEtatsFinaux);
-						minimal->final[minimal->nbEtatsFinaux-1] = classe1[i];
-					}
-				}
-			}
-			for(j = 0; j < 256; j++)
-			{
-				minimal->transition[j][classe1[i]] = transitionClasse[j][i];
-			}
-		}
+		j += dictionnaire->final[ordre[i]];
 	}
-	else
+	construireAFDViergeClasses(automate, nbAtteints, j, nbClasses, classe);
+	automate->initial = 0;
+	j = 0;
+	for (i = 0; i < nbAtteints; i++)
 	{
-		construireAFDVierge(minimal,nbClasses2,0);
-		minimal->initial = classe2[automate->initial];
-		k = 0;
-		for(i = 0; i < automate->nbEtats; i++)
+		etat = ordre[i];
+		if(dictionnaire->final[etat])
 		{
-			for(j = 0; j < automate->nbEtatsFinaux; j++)
-			{
-				if(automate->final[j] == i)
-				{
-					dejaAjoute = 0;
-					for(k = 0; k < minimal->nbEtatsFinaux; k++)
-					{
-						if(minimal->final[k] == classe2[i])
-						{
-							dejaAjoute = 1;
-						}
-					}
-					if(!dejaAjoute)
-					{
-						minimal->nbEtatsFinaux++;
-						minimal->final = realloc(minimal->final, sizeof(int)*minimal->nbEtatsFinaux);
-						minimal->final[minimal->nbEtatsFinaux-1] = classe2[i];
-					}
-				}
-			}
-			for(j = 0; j < 256; j++)
-			{
-				minimal->transition[j][classe2[i]] = transitionClasse[j][i];
-			}
+			automate->final[j] = i;
+			j++;
+		}
+		for (c = 0; c < dictionnaire->nbTransitions[etat]; c++)
+		{
+			automate->transition[classe[dictionnaire->transition[etat][c].debut]][i] = numero[dictionnaire->transition[etat][c].arrivee];
 		}
 	}
+	compresserAFD(automate);
 
-	//on libère les tableaux de transitions et de classes 
-	for (i = 0; i < 256; i++)
+	free(ordre);
+	free(numero);
+}
+
+//construit l'automate déterministe reconnaissant le seul mot fourni
+static void construireAFDMot(char* mot, int longueurMot, AFD* automate)
+{
+	int i;
+
+	construireAFDVierge(automate, longueurMot + 1, 1);
+	automate->initial = 0;
+	automate->final[0] = longueurMot;
+	for (i = 0; i < longueurMot; i++)
 	{
-		free(transitionClasse[i]);
+		automate->transition[(unsigned char)mot[i]][i] = i + 1;
 	}
-	free(classe1);
-	free(classe2);
+	compresserAFD(automate);
+}
+
+void ajouterMotAFD(AFD* automate, char* mot, int longueurMot, AFD* resultat)
+{
+	AFD automateMot;
+
+	construireAFDMot(mot, longueurMot, &automateMot);
+	produitAFD(automate, &automateMot, PRODUIT_UNION, resultat);
+	desallouerAFD(&automateMot);
+}
+
+void retirerMotAFD(AFD* automate, char* mot, int longueurMot, AFD* resultat)
+{
+	AFD automateMot;
 
-}
\ No newline at end of file
+	construireAFDMot(mot, longueurMot, &automateMot);
+	produitAFD(automate, &automateMot, PRODUIT_DIFFERENCE, resultat);
+	desallouerAFD(&automateMot);
+}
@@ -0,0 +1,1412 @@
+//banc d'essai des fonctions de automato.c
+//chaque charge de travail est générée à partir d'un paramètre de taille et chaque phase mesurée produit une ligne CSV :
+//charge,parametre,phase,secondes,rss_max_ko,quantite,unite,debit
+//rss_max_ko est le pic de mémoire résidente pendant la phase quand le noyau permet de le remettre à zéro, le pic du processus sinon
+//utilisation : ./bench [facteur], le facteur (1 par défaut) multiplie la taille de toutes les charges
+
+#define AUTOMATO_SANS_MAIN
+#include "automato.c"
+
+#include <time.h>
+#include <sys/resource.h>
+
+//structure représentant une mesure en cours
+typedef struct Mesure
+{
+	//temps cumulé en secondes
+	double secondes;
+
+	//instant de début de la dernière reprise
+	struct timespec debut;
+} Mesure;
+
+//état du générateur pseudo-aléatoire, fixé pour que les charges soient identiques d'une exécution à l'autre
+static uint64_t graine = 88172645463325252UL;
+
+//retourne un entier pseudo-aléatoire (xorshift64)
+static uint64_t aleatoire(void)
+{
+	graine ^= graine << 13;
+	graine ^= graine >> 7;
+	graine ^= graine << 17;
+	return graine;
+}
+
+//remet à zéro le pic de mémoire résidente du processus, sans effet si le noyau ne le permet pas
+static void reinitialiserPicMemoire(void)
+{
+	FILE* fichier;
+
+	fichier = fopen("/proc/self/clear_refs", "w");
+	if(fichier != NULL)
+	{
+		fputs("5", fichier);
+		fclose(fichier);
+	}
+}
+
+//retourne le pic de mémoire résidente en kilo-octets depuis la dernière remise à zéro
+static long picMemoire(void)
+{
+	FILE* fichier;
+	char ligne[256];
+	long pic;
+	struct rusage usage;
+
+	pic = -1;
+	fichier = fopen("/proc/self/status", "r");
+	if(fichier != NULL)
+	{
+		while(fgets(ligne, sizeof(ligne), fichier) != NULL)
+		{
+			if(sscanf(ligne, "VmHWM: %ld", &pic) == 1)
+			{
+				break;
+			}
+		}
+		fclose(fichier);
+	}
+	if(pic == -1)
+	{
+		getrusage(RUSAGE_SELF, &usage);
+		pic = usage.ru_maxrss;
+	}
+	return pic;
+}
+
+//démarre une nouvelle mesure
+static void debuterMesure(Mesure* mesure)
+{
+	mesure->secondes = 0;
+	reinitialiserPicMemoire();
+	clock_gettime(CLOCK_MONOTONIC, &mesure->debut);
+}
+
+//reprend une mesure interrompue par pauseMesure
+static void reprendreMesure(Mesure* mesure)
+{
+	clock_gettime(CLOCK_MONOTONIC, &mesure->debut);
+}
+
+//interrompt une mesure, le temps écoulé depuis le début ou la dernière reprise est cumulé
+static void pauseMesure(Mesure* mesure)
+{
+	struct timespec fin;
+
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	mesure->secondes += (fin.tv_sec - mesure->debut.tv_sec) + (fin.tv_nsec - mesure->debut.tv_nsec) / 1e9;
+}
+
+//affiche la ligne CSV d'une mesure terminée par pauseMesure
+//quantite est le nombre d'unités traitées pendant la phase et sert au calcul du débit
+static void afficherMesure(Mesure* mesure, const char* charge, long parametre, const char* phase, double quantite, const char* unite)
+{
+	printf("%s,%ld,%s,%.6f,%ld,%.0f,%s,%.0f\n", charge, parametre, phase, mesure->secondes, picMemoire(), quantite, unite, mesure->secondes > 0 ? quantite / mesure->secondes : 0);
+	fflush(stdout);
+}
+
+//construit l'automate d'un mot par concaténations successives d'automates à un caractère, le temps de concaténation est cumulé dans mesure
+static void construireMot(char* mot, int longueur, AFND* automate, Mesure* mesure)
+{
+	AFND caractere;
+	AFND concatenation;
+	int i;
+
+	construireAFNDLangageUnCar(automate, mot[0]);
+	for (i = 1; i < longueur; i++)
+	{
+		construireAFNDLangageUnCar(&caractere, mot[i]);
+		reprendreMesure(mesure);
+		concatenationAFND(automate, &caractere, &concatenation);
+		pauseMesure(mesure);
+		desallouerAFND(automate);
+		desallouerAFND(&caractere);
+		*automate = concatenation;
+	}
+}
+
+//mesure determiniser, les deux minimisations et la reconnaissance d'un lot de mots sur l'automate donné
+//la minimisation de Moore n'est mesurée que si l'automate déterministe a au plus limiteMoore états
+static void mesurerPhasesDeterministes(const char* charge, long parametre, AFND* automate, Mot* mots, int nbMots, int limiteMoore)
+{
+	Mesure mesure;
+	AFD deter;
+	AFD minimal;
+	AFD minimalMoore;
+	AFDCompact compact;
+	AFDCompact projete;
+	AFNDBits bits;
+	PoolThreads pool;
+	unsigned char* resultats;
+	double octets;
+	int reconnus;
+	int i;
+
+	debuterMesure(&mesure);
+	determiniser(automate, &deter);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, charge, parametre, "determiniser", deter.nbEtats, "etats");
+
+	debuterMesure(&mesure);
+	minimiserHopcroft(&deter, &minimal);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, charge, parametre, "minimiserHopcroft", deter.nbEtats, "etats");
+
+	if(deter.nbEtats <= limiteMoore)
+	{
+		debuterMesure(&mesure);
+		minimiser(&deter, &minimalMoore);
+		pauseMesure(&mesure);
+		afficherMesure(&mesure, charge, parametre, "minimiser", deter.nbEtats, "etats");
+		desallouerAFD(&minimalMoore);
+	}
+
+	octets = 0;
+	for (i = 0; i < nbMots; i++)
+	{
+		octets += mots[i].longueur;
+	}
+
+	resultats = malloc((nbMots+7)/8);
+	debuterMesure(&mesure);
+	reconnaitreLot(mots, nbMots, &minimal, resultats);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, charge, parametre, "reconnaitreLot", octets, "octets");
+
+	//le démarrage des threads n'est pas compté dans la mesure
+	creerPoolThreads(&pool, 0);
+	debuterMesure(&mesure);
+	reconnaitreLotParallele(mots, nbMots, &minimal, resultats, &pool);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, charge, parametre, "reconnaitreLotParallele", octets, "octets");
+	detruirePoolThreads(&pool);
+
+	compilerAFD(&minimal, &compact);
+	reconnus = 0;
+	debuterMesure(&mesure);
+	for (i = 0; i < nbMots; i++)
+	{
+		reconnus += est_reconnu_compact(mots[i].caracteres, mots[i].longueur, &compact);
+	}
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, charge, parametre, "est_reconnu_compact", octets, "octets");
+
+	//aller-retour par le format de fichier, le chargement ne fait que projeter le fichier
+	debuterMesure(&mesure);
+	enregistrerAFDCompact(&compact, "/tmp/bench_automato.afd");
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, charge, parametre, "enregistrerAFDCompact", minimal.nbEtats, "etats");
+	debuterMesure(&mesure);
+	if(chargerAFDCompact("/tmp/bench_automato.afd", &projete))
+	{
+		pauseMesure(&mesure);
+		afficherMesure(&mesure, charge, parametre, "chargerAFDCompact", minimal.nbEtats, "etats");
+		desallouerAFDCompact(&projete);
+	}
+	unlink("/tmp/bench_automato.afd");
+
+	//le nombre de mots reconnus est affiché pour que le compilateur ne supprime pas la boucle
+	fprintf(stderr, "%s %ld : %d etats minimaux, %d mots reconnus sur %d\n", charge, parametre, minimal.nbEtats, reconnus, nbMots);
+
+	//la simulation par vecteurs de bits ne s'applique qu'aux petits automates non déterministes
+	debuterMesure(&mesure);
+	if(construireAFNDBits(automate, &bits))
+	{
+		pauseMesure(&mesure);
+		afficherMesure(&mesure, charge, parametre, "construireAFNDBits", automate->nbEtats, "etats");
+
+		reconnus = 0;
+		debuterMesure(&mesure);
+		for (i = 0; i < nbMots; i++)
+		{
+			reconnus += est_reconnu_bits(mots[i].caracteres, mots[i].longueur, &bits);
+		}
+		pauseMesure(&mesure);
+		afficherMesure(&mesure, charge, parametre, "est_reconnu_bits", octets, "octets");
+		fprintf(stderr, "%s %ld : %d mots reconnus par vecteurs de bits\n", charge, parametre, reconnus);
+		desallouerAFNDBits(&bits);
+	}
+
+	desallouerAFDCompact(&compact);
+	free(resultats);
+	desallouerAFD(&minimal);
+	desallouerAFD(&deter);
+}
+
+//union de nbMots mots littéraux de longueur fixe, puis reconnaissance d'autant de mots dont la moitié appartient au langage
+static void chargeUnionLitteraux(int nbMots, int longueur)
+{
+	Mesure concatenation;
+	Mesure unionMesure;
+	Mesure expressionMesure;
+	Mesure enPlace;
+	Mesure mesure;
+	AFND totalEnPlace;
+	AFND moitie;
+	AFD deter;
+	AFD minimal;
+	AFD minimalMoitie;
+	AFD difference;
+	int reconnus;
+	AFND total;
+	AFND mot;
+	AFND nouveau;
+	AFND glushkov;
+	Mot* mots;
+	char* texte;
+	char* expression;
+	int i,j;
+
+	texte = malloc((size_t)2*nbMots*longueur);
+	mots = malloc(sizeof(Mot)*2*nbMots);
+	for (i = 0; i < 2*nbMots; i++)
+	{
+		mots[i].caracteres = texte + (size_t)i*longueur;
+		mots[i].longueur = longueur;
+		for (j = 0; j < longueur; j++)
+		{
+			mots[i].caracteres[j] = 'a' + aleatoire() % 26;
+		}
+	}
+
+	debuterMesure(&concatenation);
+	pauseMesure(&concatenation);
+	debuterMesure(&unionMesure);
+	pauseMesure(&unionMesure);
+	construireMot(mots[0].caracteres, longueur, &total, &concatenation);
+	for (i = 1; i < nbMots; i++)
+	{
+		construireMot(mots[i].caracteres, longueur, &mot, &concatenation);
+		reprendreMesure(&unionMesure);
+		unionAFND(&total, &mot, &nouveau);
+		pauseMesure(&unionMesure);
+		desallouerAFND(&total);
+		desallouerAFND(&mot);
+		total = nouveau;
+	}
+	afficherMesure(&concatenation, "union_litteraux", nbMots, "concatenationAFND", (double)nbMots*(longueur-1), "appels");
+	afficherMesure(&unionMesure, "union_litteraux", nbMots, "unionAFND", nbMots - 1, "appels");
+
+	//la même union construite par les combinateurs en place, qui reprennent les états sans les recopier
+	debuterMesure(&enPlace);
+	pauseMesure(&enPlace);
+	construireMot(mots[0].caracteres, longueur, &totalEnPlace, &concatenation);
+	for (i = 1; i < nbMots; i++)
+	{
+		construireMot(mots[i].caracteres, longueur, &mot, &concatenation);
+		reprendreMesure(&enPlace);
+		unionAFNDEnPlace(&totalEnPlace, &mot);
+		pauseMesure(&enPlace);
+	}
+	afficherMesure(&enPlace, "union_litteraux", nbMots, "unionAFNDEnPlace", nbMots - 1, "appels");
+	desallouerAFND(&totalEnPlace);
+
+	//la même union écrite comme expression rationnelle mot1|mot2|... et construite en une passe
+	expression = malloc((size_t)nbMots*(longueur+1));
+	for (i = 0; i < nbMots; i++)
+	{
+		memcpy(expression + (size_t)i*(longueur+1), mots[i].caracteres, longueur);
+		expression[(size_t)i*(longueur+1) + longueur] = i + 1 < nbMots ? '|' : '\0';
+	}
+	debuterMesure(&expressionMesure);
+	construireAFNDExpression(expression, &glushkov);
+	pauseMesure(&expressionMesure);
+	afficherMesure(&expressionMesure, "union_litteraux", nbMots, "construireAFNDExpression", (double)nbMots*(longueur+1), "octets");
+	desallouerAFND(&glushkov);
+	free(expression);
+
+	mesurerPhasesDeterministes("union_litteraux", nbMots, &total, mots, 2*nbMots, 20000);
+
+	//les mots de l'union absents de sa première moitié, en un seul automate produit au lieu de deux parcours
+	determiniser(&total, &deter);
+	minimiserHopcroft(&deter, &minimal);
+	desallouerAFD(&deter);
+	construireMot(mots[0].caracteres, longueur, &moitie, &concatenation);
+	for (i = 1; i < nbMots/2; i++)
+	{
+		construireMot(mots[i].caracteres, longueur, &mot, &concatenation);
+		unionAFNDEnPlace(&moitie, &mot);
+	}
+	determiniser(&moitie, &deter);
+	minimiserHopcroft(&deter, &minimalMoitie);
+	desallouerAFD(&deter);
+	desallouerAFND(&moitie);
+	debuterMesure(&mesure);
+	differenceAFD(&minimal, &minimalMoitie, &difference);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "union_litteraux", nbMots, "differenceAFD", difference.nbEtats, "etats");
+	reconnus = 0;
+	debuterMesure(&mesure);
+	for (i = 0; i < 2*nbMots; i++)
+	{
+		reconnus += est_reconnu(mots[i].caracteres, mots[i].longueur, &minimal) && !est_reconnu(mots[i].caracteres, mots[i].longueur, &minimalMoitie);
+	}
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "union_litteraux", nbMots, "est_reconnu_deux_automates", (double)2*nbMots*longueur, "octets");
+	debuterMesure(&mesure);
+	for (i = 0; i < 2*nbMots; i++)
+	{
+		reconnus -= est_reconnu(mots[i].caracteres, mots[i].longueur, &difference);
+	}
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "union_litteraux", nbMots, "est_reconnu_difference", (double)2*nbMots*longueur, "octets");
+	fprintf(stderr, "union_litteraux %ld : difference de %d etats, %d ecarts avec les deux automates\n", (long)nbMots, difference.nbEtats, reconnus);
+	desallouerAFD(&minimal);
+	desallouerAFD(&minimalMoitie);
+	desallouerAFD(&difference);
+
+	desallouerAFND(&total);
+	free(mots);
+	free(texte);
+}
+
+//étoiles imbriquées (((a*b)*c)*...)* sur profondeur niveaux
+static void chargeEtoilesImbriquees(int profondeur, int nbMots)
+{
+	Mesure concatenation;
+	Mesure kleene;
+	AFND courant;
+	AFND caractere;
+	AFND temporaire;
+	Mot* mots;
+	char* texte;
+	int i,j;
+
+	debuterMesure(&concatenation);
+	pauseMesure(&concatenation);
+	debuterMesure(&kleene);
+	pauseMesure(&kleene);
+
+	construireAFNDLangageUnCar(&courant, 'a');
+	for (i = 1; i <= profondeur; i++)
+	{
+		reprendreMesure(&kleene);
+		fermetureIterativeDeKleene(&courant, &temporaire);
+		pauseMesure(&kleene);
+		desallouerAFND(&courant);
+
+		construireAFNDLangageUnCar(&caractere, 'a' + i % 26);
+		reprendreMesure(&concatenation);
+		concatenationAFND(&temporaire, &caractere, &courant);
+		pauseMesure(&concatenation);
+		desallouerAFND(&temporaire);
+		desallouerAFND(&caractere);
+	}
+	reprendreMesure(&kleene);
+	fermetureIterativeDeKleene(&courant, &temporaire);
+	pauseMesure(&kleene);
+	desallouerAFND(&courant);
+	courant = temporaire;
+
+	afficherMesure(&kleene, "etoiles_imbriquees", profondeur, "fermetureIterativeDeKleene", profondeur + 1, "appels");
+	afficherMesure(&concatenation, "etoiles_imbriquees", profondeur, "concatenationAFND", profondeur, "appels");
+
+	//mots de 64 caractères pris parmi les premières lettres utilisées par l'expression
+	texte = malloc((size_t)nbMots*64);
+	mots = malloc(sizeof(Mot)*nbMots);
+	for (i = 0; i < nbMots; i++)
+	{
+		mots[i].caracteres = texte + (size_t)i*64;
+		mots[i].longueur = 64;
+		for (j = 0; j < 64; j++)
+		{
+			mots[i].caracteres[j] = 'a' + aleatoire() % (profondeur < 25 ? profondeur + 1 : 26);
+		}
+	}
+
+	mesurerPhasesDeterministes("etoiles_imbriquees", profondeur, &courant, mots, nbMots, 20000);
+
+	desallouerAFND(&courant);
+	free(mots);
+	free(texte);
+}
+
+//construit (a|b)*a(a|b){n}, dont l'automate déterministe a plus de 2^n états
+static void construireExplosion(int n, AFND* automate)
+{
+	AFND a;
+	AFND b;
+	AFND aOuB;
+	AFND temporaire;
+	int i;
+
+	construireAFNDLangageUnCar(&a, 'a');
+	construireAFNDLangageUnCar(&b, 'b');
+	unionAFND(&a, &b, &aOuB);
+	fermetureIterativeDeKleene(&aOuB, &temporaire);
+	concatenationAFND(&temporaire, &a, automate);
+	desallouerAFND(&temporaire);
+	for (i = 0; i < n; i++)
+	{
+		concatenationAFND(automate, &aOuB, &temporaire);
+		desallouerAFND(automate);
+		*automate = temporaire;
+	}
+	desallouerAFND(&a);
+	desallouerAFND(&b);
+	desallouerAFND(&aOuB);
+}
+
+//explosion de la construction par sous-ensembles sur (a|b)*a(a|b){n}
+static void chargeExplosion(int n, int nbMots)
+{
+	Mesure mesure;
+	AFND automate;
+	AFDParesseux paresseux;
+	double octets;
+	int reconnus;
+	Mot* mots;
+	char* texte;
+	int i,j;
+
+	construireExplosion(n, &automate);
+
+	texte = malloc((size_t)nbMots*64);
+	mots = malloc(sizeof(Mot)*nbMots);
+	for (i = 0; i < nbMots; i++)
+	{
+		mots[i].caracteres = texte + (size_t)i*64;
+		mots[i].longueur = 64;
+		for (j = 0; j < 64; j++)
+		{
+			mots[i].caracteres[j] = 'a' + aleatoire() % 2;
+		}
+	}
+
+	mesurerPhasesDeterministes("explosion", n, &automate, mots, nbMots, 20000);
+
+	//reconnaissance paresseuse avec un cache d'un mégaoctet, sans déterminisation préalable
+	octets = 0;
+	reconnus = 0;
+	construireAFDParesseux(&automate, 1 << 20, &paresseux);
+	debuterMesure(&mesure);
+	for (i = 0; i < nbMots; i++)
+	{
+		reconnus += est_reconnu_paresseux(mots[i].caracteres, mots[i].longueur, &paresseux);
+		octets += mots[i].longueur;
+	}
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "explosion", n, "est_reconnu_paresseux", octets, "octets");
+	fprintf(stderr, "explosion %ld : %d mots reconnus par l'automate paresseux, %d vidages\n", (long)n, reconnus, paresseux.nbVidages);
+	desallouerAFDParesseux(&paresseux);
+
+	desallouerAFND(&automate);
+	free(mots);
+	free(texte);
+}
+
+//automate paresseux construit dans une arène puis utilisé et libéré sans elle, puis construit avec malloc et utilisé sous une arène :
+//son cache, vidé souvent, doit donner les mêmes réponses qu'un automate paresseux jamais exposé à une arène et ne rien prendre à l'arène
+//retourne le nombre d'écarts, chacun étant signalé sur la sortie d'erreur
+static int chargeParesseuxArene(int n, int nbMots)
+{
+	Arene arene;
+	AFND automate;
+	AFDParesseux reference;
+	AFDParesseux paresseux;
+	unsigned char* attendus;
+	BlocArene* bloc;
+	size_t utilise;
+	char mot[64];
+	int ecarts;
+	int i,j;
+
+	ecarts = 0;
+	construireExplosion(n, &automate);
+	initialiserArene(&arene, 0);
+
+	//réponses de référence, tout venant de malloc
+	attendus = malloc(nbMots);
+	construireAFDParesseux(&automate, 1 << 20, &reference);
+	graine = 88172645463325252UL;
+	for (i = 0; i < nbMots; i++)
+	{
+		for (j = 0; j < 64; j++)
+		{
+			mot[j] = 'a' + aleatoire() % 2;
+		}
+		attendus[i] = est_reconnu_paresseux(mot, 64, &reference);
+	}
+	desallouerAFDParesseux(&reference);
+
+	//construit dans l'arène, puis utilisé et libéré après retour à malloc, avec un petit cache pour qu'il soit vidé
+	utiliserArene(&arene, NULL);
+	construireAFDParesseux(&automate, 1 << 14, &paresseux);
+	utiliserArene(NULL, NULL);
+	graine = 88172645463325252UL;
+	for (i = 0; i < nbMots; i++)
+	{
+		for (j = 0; j < 64; j++)
+		{
+			mot[j] = 'a' + aleatoire() % 2;
+		}
+		if(est_reconnu_paresseux(mot, 64, &paresseux) != attendus[i])
+		{
+			ecarts++;
+		}
+	}
+	fprintf(stderr, "paresseux_arene %d : %d vidages apres construction dans une arene\n", n, paresseux.nbVidages);
+	desallouerAFDParesseux(&paresseux);
+	viderArene(&arene);
+
+	//construit avec malloc, puis utilisé sous une arène qui ne doit pas grandir
+	construireAFDParesseux(&automate, 1 << 14, &paresseux);
+	utiliserArene(&arene, NULL);
+	bloc = arene.bloc;
+	utilise = bloc == NULL ? 0 : bloc->utilise;
+	graine = 88172645463325252UL;
+	for (i = 0; i < nbMots; i++)
+	{
+		for (j = 0; j < 64; j++)
+		{
+			mot[j] = 'a' + aleatoire() % 2;
+		}
+		if(est_reconnu_paresseux(mot, 64, &paresseux) != attendus[i])
+		{
+			ecarts++;
+		}
+	}
+	if(arene.bloc != bloc || (bloc != NULL && bloc->utilise != utilise))
+	{
+		fprintf(stderr, "ERREUR paresseux_arene %d : le cache a pris de la memoire dans l'arene courante\n", n);
+		ecarts++;
+	}
+	utiliserArene(NULL, NULL);
+	desallouerAFDParesseux(&paresseux);
+	fprintf(stderr, "paresseux_arene %d : %d ecarts\n", n, ecarts);
+
+	detruireArene(&arene);
+	desallouerAFND(&automate);
+	free(attendus);
+	return ecarts;
+}
+
+//reconnaissance d'un long flux de taille octets sur l'automate minimal de (a|b|\n)*a(a|b|\n){8},
+//puis de chacune de ses lignes sur l'automate minimal de (a|b)*a(a|b){8}
+static void chargeFluxLong(long taille)
+{
+	Mesure mesure;
+	AFND automate;
+	AFD deter;
+	AFD minimal;
+	AFND automateFlux;
+	AFD deterFlux;
+	AFD minimalFlux;
+	AFDCompact compact;
+	PoolThreads pool;
+	FluxAFD flux;
+	Recherche recherche;
+	Occurrence* occurrences;
+	AFND motif;
+	AFND caractere;
+	AFND temporaire;
+	size_t nbOccurrences;
+	unsigned char* resultats;
+	char* texte;
+	int reconnu;
+	int nbLignes;
+	long i;
+
+	construireExplosion(8, &automate);
+	determiniser(&automate, &deter);
+	minimiserHopcroft(&deter, &minimal);
+
+	//une transition absente rejetant le mot, le flux entier n'est lu jusqu'au bout que si le langage couvre les retours à la ligne
+	construireAFNDExpression("(a|b|\\n)*a(a|b|\\n){8}", &automateFlux);
+	determiniser(&automateFlux, &deterFlux);
+	minimiserHopcroft(&deterFlux, &minimalFlux);
+	compilerAFD(&minimalFlux, &compact);
+
+	//lignes de 79 caractères a ou b suivies d'un retour à la ligne
+	texte = malloc(taille);
+	for (i = 0; i < taille; i++)
+	{
+		texte[i] = i % 80 == 79 ? '\n' : 'a' + aleatoire() % 2;
+	}
+
+	//le flux entier est lu comme un seul mot, les retours à la ligne faisant partie de l'alphabet du langage
+	debuterMesure(&mesure);
+	reconnu = est_reconnu(texte, taille, &minimalFlux);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "flux_long", taille, "est_reconnu", taille, "octets");
+
+	debuterMesure(&mesure);
+	reconnu += est_reconnu_compact(texte, taille, &compact);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "flux_long", taille, "est_reconnu_compact", taille, "octets");
+
+	creerPoolThreads(&pool, 0);
+	debuterMesure(&mesure);
+	reconnu += est_reconnu_parallele(texte, taille, &minimalFlux, &pool);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "flux_long", taille, "est_reconnu_parallele", taille, "octets");
+	detruirePoolThreads(&pool);
+
+	//le flux est fourni par morceaux de 4 Ko comme le ferait une lecture sur un socket
+	debuterMesure(&mesure);
+	debuterFlux(&flux, &minimalFlux);
+	for (i = 0; i < taille; i += 4096)
+	{
+		alimenterFlux(&flux, texte + i, taille - i < 4096 ? taille - i : 4096);
+	}
+	reconnu += terminerFlux(&flux);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "flux_long", taille, "alimenterFlux", taille, "octets");
+
+	//recherche du motif abba, que l'on trouve environ une fois tous les 16 caractères
+	construireAFNDLangageUnCar(&motif, 'a');
+	for (i = 1; i < 4; i++)
+	{
+		construireAFNDLangageUnCar(&caractere, "abba"[i]);
+		concatenationAFND(&motif, &caractere, &temporaire);
+		desallouerAFND(&motif);
+		desallouerAFND(&caractere);
+		motif = temporaire;
+	}
+	preparerRecherche(&motif, &recherche);
+	debuterMesure(&mesure);
+	nbOccurrences = rechercherPlusLonguesAGauche(texte, taille, &recherche, &occurrences);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "flux_long", taille, "rechercherPlusLonguesAGauche", taille, "octets");
+	free(occurrences);
+
+	debuterMesure(&mesure);
+	nbOccurrences += rechercherToutes(texte, taille, &recherche, &occurrences);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "flux_long", taille, "rechercherToutes", taille, "octets");
+	free(occurrences);
+	desallouerRecherche(&recherche);
+	desallouerAFND(&motif);
+
+	//chaque ligne est un mot distinct de (a|b)*a(a|b){8}
+	resultats = malloc(taille/8 + 1);
+	debuterMesure(&mesure);
+	nbLignes = reconnaitreTampon(texte, taille, &minimal, resultats);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "flux_long", taille, "reconnaitreTampon", taille, "octets");
+
+	fprintf(stderr, "flux_long %ld : %d lignes, %d, %zu occurrences\n", taille, nbLignes, reconnu, nbOccurrences);
+
+	free(resultats);
+	free(texte);
+	desallouerAFDCompact(&compact);
+	desallouerAFD(&minimalFlux);
+	desallouerAFD(&deterFlux);
+	desallouerAFND(&automateFlux);
+	desallouerAFD(&minimal);
+	desallouerAFD(&deter);
+	desallouerAFND(&automate);
+}
+
+//recherche de ERREUR dans un journal de taille octets où le mot n'apparaît que sur la dernière ligne,
+//l'automate compact traverse les états qu'un seul octet fait quitter par memchr et s'arrête une fois ERREUR lu
+static void chargeJournal(long taille)
+{
+	Mesure mesure;
+	AFND automate;
+	AFD deter;
+	AFD minimal;
+	AFDCompact compact;
+	char* texte;
+	int reconnu;
+	long i;
+
+	//. ne reconnaît pas le retour à la ligne, qui rejetterait le journal dès la première ligne
+	construireAFNDExpression("(.|\\n)*ERREUR(.|\\n)*", &automate);
+	determiniser(&automate, &deter);
+	minimiserHopcroft(&deter, &minimal);
+	compilerAFD(&minimal, &compact);
+
+	//lignes de 79 caractères minuscules suivies d'un retour à la ligne, la dernière contient ERREUR
+	texte = malloc(taille);
+	for (i = 0; i < taille; i++)
+	{
+		texte[i] = i % 80 == 79 ? '\n' : 'a' + aleatoire() % 26;
+	}
+	memcpy(texte + taille - 16, "ERREUR", 6);
+
+	debuterMesure(&mesure);
+	reconnu = est_reconnu(texte, taille, &minimal);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "journal", taille, "est_reconnu", taille, "octets");
+
+	debuterMesure(&mesure);
+	reconnu += est_reconnu_compact(texte, taille, &compact);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "journal", taille, "est_reconnu_compact", taille, "octets");
+
+	fprintf(stderr, "journal %ld : %d, %d états accélérés sur %d\n", taille, reconnu, compact.nbEtatsAcceleres, compact.nbEtats);
+
+	free(texte);
+	desallouerAFDCompact(&compact);
+	desallouerAFD(&minimal);
+	desallouerAFD(&deter);
+	desallouerAFND(&automate);
+}
+
+//compile nbMotifs petites expressions jusqu'à l'automate minimal, avec malloc puis dans une arène vidée après chaque motif
+static void chargePetitsMotifs(int nbMotifs)
+{
+	Mesure mesure;
+	Arene arene;
+	AFND automate;
+	AFD deter;
+	AFD minimal;
+	char motif[32];
+	char lettres[8];
+	int etats;
+	int passe;
+	int i,j;
+
+	initialiserArene(&arene, 0);
+	for (passe = 0; passe < 2; passe++)
+	{
+		etats = 0;
+		debuterMesure(&mesure);
+		if(passe == 1)
+		{
+			utiliserArene(&arene, NULL);
+		}
+		//les lettres des motifs sont tirées au hasard, les mêmes aux deux passes
+		graine = 88172645463325252UL;
+		for (i = 0; i < nbMotifs; i++)
+		{
+			for (j = 0; j < 8; j++)
+			{
+				lettres[j] = 'a' + aleatoire() % 6;
+			}
+			snprintf(motif, sizeof(motif), "%c%c(%c|%c%c)*%c+[%c-z]?%c{1,3}", lettres[0], lettres[1], lettres[2], lettres[3], lettres[4], lettres[5], lettres[6], lettres[7]);
+			construireAFNDExpression(motif, &automate);
+			determiniser(&automate, &deter);
+			minimiserHopcroft(&deter, &minimal);
+			etats += minimal.nbEtats;
+			desallouerAFD(&minimal);
+			desallouerAFD(&deter);
+			desallouerAFND(&automate);
+			if(passe == 1)
+			{
+				viderArene(&arene);
+			}
+		}
+		utiliserArene(NULL, NULL);
+		pauseMesure(&mesure);
+		afficherMesure(&mesure, "petits_motifs", nbMotifs, passe == 0 ? "compilation_malloc" : "compilation_arene", nbMotifs, "motifs");
+		fprintf(stderr, "petits_motifs %d : %d etats minimaux\n", nbMotifs, etats);
+	}
+	detruireArene(&arene);
+}
+
+//nbCompilations compilations de motifs tirés parmi nbMotifs, sans puis avec un cache de compilation :
+//les services qui reconstruisent sans cesse les mêmes langages ne paient la déterminisation qu'une fois par motif
+static void chargeCacheCompilation(int nbMotifs, int nbCompilations)
+{
+	Mesure mesure;
+	CacheCompilation cache;
+	AFND automate;
+	AFD deter;
+	AFD minimal;
+	char (*motifs)[32];
+	char lettres[8];
+	long etats;
+	int passe;
+	int i,j;
+
+	motifs = malloc(sizeof(*motifs)*nbMotifs);
+	for (i = 0; i < nbMotifs; i++)
+	{
+		for (j = 0; j < 8; j++)
+		{
+			lettres[j] = 'a' + aleatoire() % 6;
+		}
+		snprintf(motifs[i], sizeof(motifs[i]), "%c%c(%c|%c%c)*%c+[%c-z]?%c{1,3}", lettres[0], lettres[1], lettres[2], lettres[3], lettres[4], lettres[5], lettres[6], lettres[7]);
+	}
+
+	initialiserCacheCompilation(&cache, 0);
+	for (passe = 0; passe < 2; passe++)
+	{
+		etats = 0;
+		debuterMesure(&mesure);
+		//les motifs sont tirés au hasard, les mêmes aux deux passes
+		graine = 88172645463325252UL;
+		for (i = 0; i < nbCompilations; i++)
+		{
+			construireAFNDExpression(motifs[aleatoire() % nbMotifs], &automate);
+			if(passe == 0)
+			{
+				determiniser(&automate, &deter);
+				minimiserHopcroft(&deter, &minimal);
+				desallouerAFD(&deter);
+			}
+			else
+			{
+				compilerAFNDCache(&automate, &cache, &minimal);
+			}
+			etats += minimal.nbEtats;
+			desallouerAFD(&minimal);
+			desallouerAFND(&automate);
+		}
+		pauseMesure(&mesure);
+		afficherMesure(&mesure, "cache_compilation", nbMotifs, passe == 0 ? "sans_cache" : "compilerAFNDCache", nbCompilations, "compilations");
+		fprintf(stderr, "cache_compilation %d : %ld etats minimaux, %ld compilations trouvées dans le cache\n", nbMotifs, etats, cache.nbSucces);
+	}
+	detruireCacheCompilation(&cache);
+	free(motifs);
+}
+
+//compare deux mots par leurs caractères puis par leur longueur, pour trier et chercher des mots par qsort et bsearch
+static int comparerMots(const void* a, const void* b)
+{
+	Mot* mot1 = (Mot*)a;
+	Mot* mot2 = (Mot*)b;
+	int ordre;
+
+	ordre = memcmp(mot1->caracteres, mot2->caracteres, mot1->longueur < mot2->longueur ? mot1->longueur : mot2->longueur);
+	return ordre ? ordre : mot1->longueur - mot2->longueur;
+}
+
+//retourne le nombre de mots distincts parmi les nbMots mots fournis
+static long compterMotsDistincts(Mot* mots, int nbMots)
+{
+	Mot* tries;
+	long distincts;
+	int i;
+
+	tries = malloc(sizeof(Mot)*(nbMots + 1));
+	memcpy(tries, mots, sizeof(Mot)*nbMots);
+	qsort(tries, nbMots, sizeof(Mot), comparerMots);
+	distincts = 0;
+	for (i = 0; i < nbMots; i++)
+	{
+		distincts += i == 0 || comparerMots(&tries[i-1], &tries[i]) != 0;
+	}
+	free(tries);
+	return distincts;
+}
+
+//construit l'automate minimal de l'union des mots fournis par une expression rationnelle, sans dictionnaire
+static void reconstruireMinimalMots(Mot* mots, int nbMots, AFD* minimal)
+{
+	AFND automate;
+	AFD deter;
+	char* expression;
+	size_t position;
+	int i;
+
+	position = 0;
+	for (i = 0; i < nbMots; i++)
+	{
+		position += mots[i].longueur + 1;
+	}
+	expression = malloc(position + 1);
+	position = 0;
+	for (i = 0; i < nbMots; i++)
+	{
+		if(i > 0)
+		{
+			expression[position++] = '|';
+		}
+		memcpy(expression + position, mots[i].caracteres, mots[i].longueur);
+		position += mots[i].longueur;
+	}
+	expression[position] = '\0';
+	construireAFNDExpression(expression, &automate);
+	determiniser(&automate, &deter);
+	minimiserHopcroft(&deter, minimal);
+	desallouerAFD(&deter);
+	desallouerAFND(&automate);
+	free(expression);
+}
+
+//compare le dictionnaire à l'automate minimal reconstruit du même ensemble de nbDistincts mots :
+//même nombre d'états, même nombre de mots et même réponse sur chacun des nbMots mots fournis
+//retourne le nombre d'écarts, chacun étant signalé sur la sortie d'erreur
+static int verifierDictionnaire(const char* etape, DictionnaireAFD* dictionnaire, AFD* minimal, long nbDistincts, Mot* mots, int nbMots)
+{
+	AFD converti;
+	int ecarts;
+	int i;
+
+	ecarts = 0;
+	convertirDictionnaireAFD(dictionnaire, &converti);
+	if(converti.nbEtats != minimal->nbEtats)
+	{
+		fprintf(stderr, "ERREUR dictionnaire %s : %d etats incrementaux, %d etats reconstruits\n", etape, converti.nbEtats, minimal->nbEtats);
+		ecarts++;
+	}
+	if(dictionnaire->nbMots != nbDistincts)
+	{
+		fprintf(stderr, "ERREUR dictionnaire %s : %ld mots au lieu de %ld\n", etape, dictionnaire->nbMots, nbDistincts);
+		ecarts++;
+	}
+	for (i = 0; i < nbMots; i++)
+	{
+		if(est_reconnu_dictionnaire(mots[i].caracteres, mots[i].longueur, dictionnaire) != est_reconnu(mots[i].caracteres, mots[i].longueur, minimal)
+			|| est_reconnu(mots[i].caracteres, mots[i].longueur, &converti) != est_reconnu(mots[i].caracteres, mots[i].longueur, minimal))
+		{
+			fprintf(stderr, "ERREUR dictionnaire %s : reponses differentes sur le mot %d\n", etape, i);
+			ecarts++;
+		}
+	}
+	desallouerAFD(&converti);
+	return ecarts;
+}
+
+//nbMots mots de 4 à longueur lettres ajoutés un à un à un dictionnaire puis en partie retirés et remplacés,
+//comparés à une reconstruction complète de l'automate minimal du même ensemble de mots
+//retourne le nombre d'écarts entre le dictionnaire et la reconstruction
+static int chargeDictionnaire(int nbMots, int longueur)
+{
+	Mesure mesure;
+	DictionnaireAFD dictionnaire;
+	AFD minimal;
+	AFD converti;
+	Mot* mots;
+	Mot* retires;
+	Mot* restants;
+	char* texte;
+	int nbRenouveles;
+	int nbRestants;
+	int ecarts;
+	int i,j;
+
+	//2*nbMots mots, la seconde moitié remplaçant une partie de la première lors des mises à jour
+	texte = malloc((size_t)2*nbMots*longueur);
+	mots = malloc(sizeof(Mot)*2*nbMots);
+	for (i = 0; i < 2*nbMots; i++)
+	{
+		mots[i].caracteres = texte + (size_t)i*longueur;
+		mots[i].longueur = 4 + aleatoire() % (longueur - 3);
+		for (j = 0; j < mots[i].longueur; j++)
+		{
+			mots[i].caracteres[j] = 'a' + aleatoire() % 6;
+		}
+	}
+
+	debuterMesure(&mesure);
+	construireDictionnaireVide(&dictionnaire);
+	for (i = 0; i < nbMots; i++)
+	{
+		ajouterMotDictionnaire(&dictionnaire, mots[i].caracteres, mots[i].longueur);
+	}
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "dictionnaire", nbMots, "ajouterMotDictionnaire", nbMots, "mots");
+
+	//reconstruction complète de l'union des mots, ce que chaque mise à jour coûtait jusqu'ici
+	debuterMesure(&mesure);
+	reconstruireMinimalMots(mots, nbMots, &minimal);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "dictionnaire", nbMots, "reconstruction", nbMots, "mots");
+
+	debuterMesure(&mesure);
+	convertirDictionnaireAFD(&dictionnaire, &converti);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "dictionnaire", nbMots, "convertirDictionnaireAFD", converti.nbEtats, "etats");
+	fprintf(stderr, "dictionnaire %d : %ld mots, %d etats incrementaux, %d etats reconstruits\n", nbMots, dictionnaire.nbMots, converti.nbEtats, minimal.nbEtats);
+	desallouerAFD(&converti);
+	ecarts = verifierDictionnaire("construction", &dictionnaire, &minimal, compterMotsDistincts(mots, nbMots), mots, 2*nbMots);
+	desallouerAFD(&minimal);
+
+	//un dixième des mots est retiré et remplacé par de nouveaux mots
+	nbRenouveles = nbMots / 10;
+	debuterMesure(&mesure);
+	for (i = 0; i < nbRenouveles; i++)
+	{
+		retirerMotDictionnaire(&dictionnaire, mots[i].caracteres, mots[i].longueur);
+		ajouterMotDictionnaire(&dictionnaire, mots[nbMots + i].caracteres, mots[nbMots + i].longueur);
+	}
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "dictionnaire", nbMots, "mise_a_jour", 2*nbRenouveles, "mots");
+	fprintf(stderr, "dictionnaire %d : %ld mots, %d etats apres mise a jour\n", nbMots, dictionnaire.nbMots, dictionnaire.nbEtats - dictionnaire.nbLibres);
+
+	//après la mise à jour restent les mots gardés qui n'ont pas été retirés sous un autre numéro, plus tous les mots ajoutés,
+	//le retrait d'un mot précédant toujours l'ajout de même rang
+	retires = malloc(sizeof(Mot)*(nbRenouveles + 1));
+	memcpy(retires, mots, sizeof(Mot)*nbRenouveles);
+	qsort(retires, nbRenouveles, sizeof(Mot), comparerMots);
+	restants = malloc(sizeof(Mot)*(nbMots + 1));
+	nbRestants = 0;
+	for (i = nbRenouveles; i < nbMots; i++)
+	{
+		if(bsearch(&mots[i], retires, nbRenouveles, sizeof(Mot), comparerMots) == NULL)
+		{
+			restants[nbRestants++] = mots[i];
+		}
+	}
+	for (i = 0; i < nbRenouveles; i++)
+	{
+		//un mot ajouté puis retiré sous un rang plus grand n'est plus là
+		for (j = i + 1; j < nbRenouveles && comparerMots(&mots[nbMots + i], &mots[j]) != 0; j++)
+		{
+		}
+		if(j == nbRenouveles)
+		{
+			restants[nbRestants++] = mots[nbMots + i];
+		}
+	}
+	reconstruireMinimalMots(restants, nbRestants, &minimal);
+	ecarts += verifierDictionnaire("mise a jour", &dictionnaire, &minimal, compterMotsDistincts(restants, nbRestants), mots, 2*nbMots);
+	desallouerAFD(&minimal);
+
+	desallouerDictionnaire(&dictionnaire);
+	free(restants);
+	free(retires);
+	free(mots);
+	free(texte);
+	return ecarts;
+}
+
+//dictionnaires construits à partir d'automates finis ayant des états morts qui bouclent, refus d'un langage infini,
+//et ajouts et retraits sur un langage infini par ajouterMotAFD et retirerMotAFD
+//retourne le nombre d'écarts, chacun étant signalé sur la sortie d'erreur
+static int chargeDictionnaireAFD(void)
+{
+	DictionnaireAFD dictionnaire;
+	AFND a;
+	AFND etoile;
+	AFND vide;
+	AFND concatenation;
+	AFND infini;
+	AFD deter;
+	AFD minimal;
+	AFD complet;
+	AFD modifie;
+	AFD remis;
+	int ecarts;
+	int i,c;
+
+	ecarts = 0;
+
+	//a* suivi du langage vide : deux états morts dont l'un boucle sur a, pour le langage vide
+	construireAFNDLangageUnCar(&a, 'a');
+	fermetureIterativeDeKleene(&a, &etoile);
+	construireAFNDLangageVide(&vide);
+	concatenationAFND(&etoile, &vide, &concatenation);
+	determiniser(&concatenation, &deter);
+	if(!construireDictionnaireAFD(&deter, &dictionnaire))
+	{
+		fprintf(stderr, "ERREUR dictionnaire : a* suivi du langage vide refuse\n");
+		ecarts++;
+	}
+	else
+	{
+		if(dictionnaire.nbMots != 0 || est_reconnu_dictionnaire("", 0, &dictionnaire) || est_reconnu_dictionnaire("aa", 2, &dictionnaire))
+		{
+			fprintf(stderr, "ERREUR dictionnaire : a* suivi du langage vide reconnait %ld mots\n", dictionnaire.nbMots);
+			ecarts++;
+		}
+		desallouerDictionnaire(&dictionnaire);
+	}
+	desallouerAFD(&deter);
+
+	//automate complet de {ab} : toute transition absente mène à un puits qui boucle sur lui-même
+	construireAFDVierge(&complet, 4, 1);
+	complet.initial = 0;
+	complet.final[0] = 2;
+	for (c = 0; c < 256; c++)
+	{
+		for (i = 0; i < 4; i++)
+		{
+			complet.transition[c][i] = 3;
+		}
+	}
+	complet.transition['a'][0] = 1;
+	complet.transition['b'][1] = 2;
+	compresserAFD(&complet);
+	if(!construireDictionnaireAFD(&complet, &dictionnaire))
+	{
+		fprintf(stderr, "ERREUR dictionnaire : automate complet de {ab} refuse\n");
+		ecarts++;
+	}
+	else
+	{
+		if(dictionnaire.nbMots != 1 || !est_reconnu_dictionnaire("ab", 2, &dictionnaire) || est_reconnu_dictionnaire("abb", 3, &dictionnaire))
+		{
+			fprintf(stderr, "ERREUR dictionnaire : automate complet de {ab} mal repris\n");
+			ecarts++;
+		}
+		desallouerDictionnaire(&dictionnaire);
+	}
+	desallouerAFD(&complet);
+
+	//ab*c reconnaît une infinité de mots
+	construireAFNDExpression("ab*c", &infini);
+	determiniser(&infini, &deter);
+	minimiserHopcroft(&deter, &minimal);
+	if(construireDictionnaireAFD(&minimal, &dictionnaire))
+	{
+		fprintf(stderr, "ERREUR dictionnaire : ab*c accepte\n");
+		desallouerDictionnaire(&dictionnaire);
+		ecarts++;
+	}
+
+	//les mêmes ajouts et retraits passent par l'automate produit, le retrait rendant l'automate minimal de départ
+	ajouterMotAFD(&minimal, "abd", 3, &modifie);
+	if(!est_reconnu("abd", 3, &modifie) || !est_reconnu("abbc", 4, &modifie) || est_reconnu("abdd", 4, &modifie))
+	{
+		fprintf(stderr, "ERREUR ajouterMotAFD : abd mal ajoute a ab*c\n");
+		ecarts++;
+	}
+	retirerMotAFD(&modifie, "abd", 3, &remis);
+	if(est_reconnu("abd", 3, &remis) || !est_reconnu("abbc", 4, &remis) || remis.nbEtats != minimal.nbEtats)
+	{
+		fprintf(stderr, "ERREUR retirerMotAFD : abd mal retire, %d etats au lieu de %d\n", remis.nbEtats, minimal.nbEtats);
+		ecarts++;
+	}
+	fprintf(stderr, "dictionnaire_afd : %d ecarts\n", ecarts);
+
+	desallouerAFD(&remis);
+	desallouerAFD(&modifie);
+	desallouerAFD(&minimal);
+	desallouerAFD(&deter);
+	desallouerAFND(&infini);
+	desallouerAFND(&concatenation);
+	desallouerAFND(&vide);
+	desallouerAFND(&etoile);
+	desallouerAFND(&a);
+	return ecarts;
+}
+
+//nbMotifs motifs reconnus ensemble par un automate à motifs, comparé à un automate par motif, sur nbMots mots de 16 lettres
+static void chargeMultiMotifs(int nbMotifs, int nbMots)
+{
+	Mesure mesure;
+	AFND automate;
+	AFND nouveau;
+	AFD deter;
+	AFD* separes;
+	AFDMotifs deterMotifs;
+	AFDMotifs minimal;
+	Mot* mots;
+	char* texte;
+	char motif[32];
+	char lettres[4];
+	int* reconnus;
+	long total;
+	long totalSepares;
+	int i,j;
+
+	debuterMesure(&mesure);
+	separes = malloc(sizeof(AFD)*nbMotifs);
+	for (i = 0; i < nbMotifs; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			lettres[j] = 'a' + aleatoire() % 26;
+		}
+		snprintf(motif, sizeof(motif), "%c%c[%c-z]+%c", lettres[0], lettres[1], lettres[2], lettres[3]);
+		construireAFNDExpression(motif, &nouveau);
+		determiniser(&nouveau, &deter);
+		minimiserHopcroft(&deter, &separes[i]);
+		desallouerAFD(&deter);
+		attribuerMotifAFND(&nouveau, i);
+		if(i == 0)
+		{
+			automate = nouveau;
+		}
+		else
+		{
+			unionAFNDEnPlace(&automate, &nouveau);
+		}
+	}
+	determiniserMotifs(&automate, &deterMotifs);
+	minimiserMotifs(&deterMotifs, &minimal);
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "multi_motifs", nbMotifs, "compilation", minimal.automate.nbEtats, "etats");
+
+	texte = malloc((size_t)nbMots*16);
+	mots = malloc(sizeof(Mot)*nbMots);
+	for (i = 0; i < nbMots; i++)
+	{
+		mots[i].caracteres = texte + (size_t)i*16;
+		mots[i].longueur = 16;
+		for (j = 0; j < 16; j++)
+		{
+			mots[i].caracteres[j] = 'a' + aleatoire() % 26;
+		}
+	}
+
+	//un seul parcours par mot donne tous les motifs reconnus
+	total = 0;
+	debuterMesure(&mesure);
+	for (i = 0; i < nbMots; i++)
+	{
+		total += motifsReconnus(mots[i].caracteres, mots[i].longueur, &minimal, &reconnus);
+	}
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "multi_motifs", nbMotifs, "motifsReconnus", (double)nbMots*16, "octets");
+
+	totalSepares = 0;
+	debuterMesure(&mesure);
+	for (i = 0; i < nbMots; i++)
+	{
+		for (j = 0; j < nbMotifs; j++)
+		{
+			totalSepares += est_reconnu(mots[i].caracteres, mots[i].longueur, &separes[j]);
+		}
+	}
+	pauseMesure(&mesure);
+	afficherMesure(&mesure, "multi_motifs", nbMotifs, "est_reconnu_par_motif", (double)nbMots*16, "octets");
+	fprintf(stderr, "multi_motifs %d : %d etats minimaux, %ld motifs reconnus, %ld par automates separes\n", nbMotifs, minimal.automate.nbEtats, total, totalSepares);
+
+	for (i = 0; i < nbMotifs; i++)
+	{
+		desallouerAFD(&separes[i]);
+	}
+	free(separes);
+	desallouerAFDMotifs(&deterMotifs);
+	desallouerAFDMotifs(&minimal);
+	desallouerAFND(&automate);
+	free(mots);
+	free(texte);
+}
+
+//construit l'automate à un seul motif d'un mot de deux caractères
+static void construireMotifDeuxCar(char c1, char c2, int numero, AFND* automate)
+{
+	AFND second;
+
+	construireAFNDLangageUnCar(automate, c1);
+	construireAFNDLangageUnCar(&second, c2);
+	concatenationAFNDEnPlace(automate, &second);
+	attribuerMotifAFND(automate, numero);
+}
+
+//vérifie que les motifs attribués avant une concaténation ou une fermeture de Kleene sont gardés par les états finaux qui en résultent
+//chaque mot d'au plus 6 lettres sur {a,b,c} est comparé aux automates des expressions équivalentes, construits motif par motif
+static int chargeMotifsCombines(void)
+{
+	//expressions des motifs 0 : (ab)*, 1 : ac*, 2 et 3 : (ab|b)* terminé par ab ou par b
+	static const char* expressions[4] = {"(ab)*", "ac*", "(ab|b)*ab", "(ab|b)*b"};
+	AFND automate;
+	AFND motif;
+	AFND etoile;
+	AFND copie;
+	AFND expression;
+	AFD separes[4];
+	AFD intermediaire;
+	AFDMotifs deterMotifs;
+	AFDMotifs minimal;
+	char mot[6];
+	int* reconnus;
+	int nbReconnus;
+	int attendu;
+	int ecarts;
+	int longueur;
+	long numero;
+	long reste;
+	long k;
+	int i,j;
+
+	ecarts = 0;
+	for (i = 0; i < 4; i++)
+	{
+		construireAFNDExpression(expressions[i], &expression);
+		determiniser(&expression, &intermediaire);
+		minimiserHopcroft(&intermediaire, &separes[i]);
+		desallouerAFD(&intermediaire);
+		desallouerAFND(&expression);
+	}
+
+	//(ab)* fermé en place après attribution du motif
+	construireMotifDeuxCar('a', 'b', 0, &automate);
+	fermetureIterativeDeKleeneEnPlace(&automate);
+
+	//ac* : les états finaux de c* n'ont pas de motif et reprennent celui de a, par la concaténation avec recopie
+	construireAFNDLangageUnCar(&motif, 'a');
+	attribuerMotifAFND(&motif, 1);
+	construireAFNDLangageUnCar(&etoile, 'c');
+	fermetureIterativeDeKleeneEnPlace(&etoile);
+	concatenationAFND(&motif, &etoile, &copie);
+	desallouerAFND(&motif);
+	desallouerAFND(&etoile);
+	unionAFNDEnPlace(&automate, &copie);
+
+	//(ab|b)* dont les deux branches portent des motifs différents, fermé avec recopie
+	construireMotifDeuxCar('a', 'b', 2, &motif);
+	construireAFNDLangageUnCar(&etoile, 'b');
+	attribuerMotifAFND(&etoile, 3);
+	unionAFNDEnPlace(&motif, &etoile);
+	fermetureIterativeDeKleene(&motif, &copie);
+	desallouerAFND(&motif);
+	unionAFNDEnPlace(&automate, &copie);
+
+	determiniserMotifs(&automate, &deterMotifs);
+	minimiserMotifs(&deterMotifs, &minimal);
+
+	for (longueur = 0; longueur <= 6; longueur++)
+	{
+		k = 1;
+		for (i = 0; i < longueur; i++)
+		{
+			k *= 3;
+		}
+		for (numero = 0; numero < k; numero++)
+		{
+			for (i = 0, reste = numero; i < longueur; i++, reste /= 3)
+			{
+				mot[i] = 'a' + reste % 3;
+			}
+			nbReconnus = motifsReconnus(mot, longueur, &minimal, &reconnus);
+			for (i = 0, j = 0; i < 4; i++)
+			{
+				attendu = est_reconnu(mot, longueur, &separes[i]);
+				if(attendu != (j < nbReconnus && reconnus[j] == i))
+				{
+					fprintf(stderr, "ERREUR motifs combines : motif %d %s pour %.*s\n", i, attendu ? "perdu" : "en trop", longueur, mot);
+					ecarts++;
+				}
+				if(j < nbReconnus && reconnus[j] == i)
+				{
+					j++;
+				}
+			}
+		}
+	}
+	fprintf(stderr, "motifs_combines : %d etats minimaux, %d ecarts\n", minimal.automate.nbEtats, ecarts);
+
+	for (i = 0; i < 4; i++)
+	{
+		desallouerAFD(&separes[i]);
+	}
+	desallouerAFDMotifs(&deterMotifs);
+	desallouerAFDMotifs(&minimal);
+	desallouerAFND(&automate);
+	return ecarts;
+}
+
+int main(int argc, char const *argv[])
+{
+	//facteur multipliant la taille de toutes les charges
+	int facteur;
+
+	//nombre d'écarts relevés par les charges qui vérifient leurs résultats
+	int ecarts;
+
+	facteur = 1;
+	if(argc > 1)
+	{
+		facteur = atoi(argv[1]);
+		if(facteur < 1)
+		{
+			facteur = 1;
+		}
+	}
+
+	printf("charge,parametre,phase,secondes,rss_max_ko,quantite,unite,debit\n");
+
+	chargeUnionLitteraux(250*facteur, 8);
+	chargeEtoilesImbriquees(8*facteur, 100000*facteur);
+	chargeExplosion(10 + facteur, 100000*facteur);
+	chargeFluxLong(32000000L*facteur);
+	chargeJournal(32000000L*facteur);
+	chargePetitsMotifs(20000*facteur);
+	chargeMultiMotifs(100*facteur, 20000*facteur);
+	chargeCacheCompilation(200*facteur, 20000*facteur);
+	ecarts = chargeParesseuxArene(10, 20000);
+	ecarts += chargeDictionnaire(20000*facteur, 12);
+	ecarts += chargeDictionnaireAFD();
+	ecarts += chargeMotifsCombines();
+
+	//un écart entre le dictionnaire et la reconstruction complète, ou un motif perdu, fait échouer le banc d'essai
+	return ecarts != 0;
+}
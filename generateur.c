@@ -0,0 +1,66 @@
+//générateur de reconnaisseurs spécialisés : lit une expression rationnelle dans un fichier et écrit sur la sortie standard
+//un fichier C autonome définissant int nom(const char* mot, size_t longueurMot), à compiler avec le reste du programme
+//utilisation : ./generateur [-t] fichier.regex nom > nom.c, l'option -t produit une table constante au lieu d'états reliés par goto
+//seule la première ligne du fichier est lue, sans son retour à la ligne
+
+#define AUTOMATO_SANS_MAIN
+#include "automato.c"
+
+int main(int argc, char const *argv[])
+{
+	//forme du code produit
+	int forme;
+
+	//position du premier argument non optionnel
+	int argument;
+
+	//fichier contenant l'expression
+	FILE* fichier;
+
+	//expression lue
+	char expression[65536];
+
+	//automates successifs
+	AFND nonDeter;
+	AFD deter,minimal;
+
+	forme = GENERATION_GOTO;
+	argument = 1;
+	if(argc > 1 && strcmp(argv[1], "-t") == 0)
+	{
+		forme = GENERATION_TABLE;
+		argument = 2;
+	}
+	if(argc - argument != 2)
+	{
+		fprintf(stderr, "utilisation : %s [-t] fichier.regex nom\n", argv[0]);
+		return 1;
+	}
+
+	fichier = fopen(argv[argument], "r");
+	if(fichier == NULL)
+	{
+		perror(argv[argument]);
+		return 1;
+	}
+	if(fgets(expression, sizeof(expression), fichier) == NULL)
+	{
+		expression[0] = '\0';
+	}
+	fclose(fichier);
+	expression[strcspn(expression, "\n")] = '\0';
+
+	if(!construireAFNDExpression(expression, &nonDeter))
+	{
+		fprintf(stderr, "%s : expression invalide\n", argv[argument]);
+		return 1;
+	}
+	determiniser(&nonDeter, &deter);
+	minimiserHopcroft(&deter, &minimal);
+	genererCodeC(&minimal, argv[argument + 1], forme, stdout);
+
+	desallouerAFND(&nonDeter);
+	desallouerAFD(&deter);
+	desallouerAFD(&minimal);
+	return 0;
+}